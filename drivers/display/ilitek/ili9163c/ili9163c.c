@@ -5,23 +5,33 @@
 
 #define DT_DRV_COMPAT ilitek_ili9163c
 
-#include "ili9163c.h"
+#include "ili9163c_priv.h"
+
+#include <string.h>
 
-#include <zephyr/drivers/display.h>
 #include <zephyr/sys/byteorder.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(ILI9163C, CONFIG_DISPLAY_LOG_LEVEL);
 
-struct ili9163c_data {
-	uint8_t bytes_per_pixel;
-	enum display_pixel_format pixel_format;
-	enum display_orientation orientation;
-};
+#ifdef CONFIG_ILI9163C_FIXED_CONFIG
+BUILD_ASSERT(DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) == 1,
+	     "CONFIG_ILI9163C_FIXED_CONFIG requires a single ILI9163C instance");
+#endif
+
+#ifdef CONFIG_ILI9163C_RESYNC
+static K_THREAD_STACK_DEFINE(ili9163c_resync_stack, CONFIG_ILI9163C_RESYNC_STACK_SIZE);
+static struct k_work_q ili9163c_resync_workq;
+#endif
 
-int ili9163c_transmit(const struct device *dev, uint8_t cmd, const void *tx_data, size_t tx_len)
+static inline int ili9163c_transmit(const struct device *dev, uint8_t cmd, const void *tx_data,
+				    size_t tx_len)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+
+#ifdef CONFIG_ILI9163C_RECORD
+	ili9163c_record(dev, ILI9163C_RECORD_COMMAND, cmd, tx_data, tx_len);
+#endif
 
 	return mipi_dbi_command_write(config->mipi_dev, &config->dbi_config, cmd, tx_data, tx_len);
 }
@@ -42,7 +52,11 @@ static int ili9163c_exit_sleep(const struct device *dev)
 
 static void ili9163c_hw_reset(const struct device *dev)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+
+#ifdef CONFIG_ILI9163C_RECORD
+	ili9163c_record(dev, ILI9163C_RECORD_RESET, ILI9163C_RESET_PULSE_TIME, NULL, 0U);
+#endif
 
 	if (mipi_dbi_reset(config->mipi_dev, ILI9163C_RESET_PULSE_TIME) < 0) {
 		return;
@@ -53,9 +67,19 @@ static void ili9163c_hw_reset(const struct device *dev)
 static int ili9163c_set_mem_area(const struct device *dev, const uint16_t x, const uint16_t y,
 				 const uint16_t w, const uint16_t h)
 {
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	const uint16_t window[4] = {x, x + w - 1U, y, y + h - 1U};
+
 	int r;
 	uint16_t spi_data[2];
 
+	/* RAMWR restarts from the window origin, an unchanged window is not resent. */
+	if (data->window_valid && (memcmp(data->window, window, sizeof(window)) == 0)) {
+		return 0;
+	}
+
+	data->window_valid = false;
+
 	spi_data[0] = sys_cpu_to_be16(x);
 	spi_data[1] = sys_cpu_to_be16(x + w - 1U);
 	r = ili9163c_transmit(dev, ILI9163C_CASET, &spi_data[0], 4U);
@@ -70,101 +94,502 @@ static int ili9163c_set_mem_area(const struct device *dev, const uint16_t x, con
 		return r;
 	}
 
+	memcpy(data->window, window, sizeof(window));
+	data->window_valid = true;
+
 	return 0;
 }
 
-static int ili9163c_write(const struct device *dev, const uint16_t x, const uint16_t y,
-			  const struct display_buffer_descriptor *desc, const void *buf)
+static inline int ili9163c_write_display(const struct device *dev, const uint8_t *buf,
+					 struct display_buffer_descriptor *desc)
 {
-	const struct ili9163c_config *config = dev->config;
-	struct ili9163c_data *data = dev->data;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data __maybe_unused = ILI9163C_DEV_DATA(dev);
+
+#ifdef CONFIG_ILI9163C_RECORD
+	uint8_t format = (ILI9163C_CURRENT_PIXEL_FORMAT(data) == PIXEL_FORMAT_RGB_565)
+				 ? ILI9163C_PIXEL_FORMAT_RGB565
+				 : ILI9163C_PIXEL_FORMAT_RGB888;
+
+	if (ILI9163C_IS_RGB444(data)) {
+		format = ILI9163C_PIXEL_FORMAT_RGB444;
+	}
+
+	ili9163c_record(dev, ILI9163C_RECORD_DATA, format, buf, desc->buf_size);
+#endif
+
+	return mipi_dbi_write_display(config->mipi_dev, &config->dbi_config, buf, desc,
+				      ILI9163C_CURRENT_PIXEL_FORMAT(data));
+}
+
+#ifdef CONFIG_ILI9163C_BUF_POOL
+/* Pack strided rows into a bounce buffer, to send as many rows as it holds per transfer. */
+static int ili9163c_write_packed(const struct device *dev, uint8_t *bounce, const uint8_t *buf,
+				 const struct display_buffer_descriptor *desc, uint16_t rows)
+{
+	struct ili9163c_data *data __maybe_unused = ILI9163C_DEV_DATA(dev);
+	struct display_buffer_descriptor mipi_desc;
+	size_t row_size = desc->width * ILI9163C_BYTES_PER_PIXEL(data);
+	size_t pitch_size = desc->pitch * ILI9163C_BYTES_PER_PIXEL(data);
+	uint16_t bounce_rows = CONFIG_ILI9163C_BUF_SIZE / row_size;
+
+	int r;
+	uint16_t row;
+
+	mipi_desc.width = desc->width;
+	mipi_desc.pitch = desc->width;
+
+	for (row = 0U; row < rows; row += mipi_desc.height) {
+		mipi_desc.height = MIN(bounce_rows, rows - row);
+		mipi_desc.buf_size = mipi_desc.height * row_size;
+
+		for (uint16_t i = 0U; i < mipi_desc.height; i++) {
+			memcpy(&bounce[i * row_size], &buf[(row + i) * pitch_size], row_size);
+		}
+
+		r = ili9163c_write_display(dev, bounce, &mipi_desc);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_ILI9163C_RGB444
+/* 4 most significant bits of each channel of a big endian RGB565 or an RGB888 pixel. */
+static inline uint16_t ili9163c_rgb444(const uint8_t *px, size_t bytes_per_pixel)
+{
+	if (bytes_per_pixel == 2U) {
+		return ((px[0] & 0xF0U) << 4) | ((px[0] & 0x07U) << 5) | ((px[1] & 0x80U) >> 3) |
+		       ((px[1] >> 1) & 0x0FU);
+	}
+
+	return ((px[0] & 0xF0U) << 4) | (px[1] & 0xF0U) | (px[2] >> 4);
+}
+
+static int ili9163c_write_rgb444_bytes(const struct device *dev, const uint8_t *buf, size_t len)
+{
+	struct display_buffer_descriptor mipi_desc = {
+		.buf_size = len,
+		.width = len * 2U / 3U,
+		.height = 1U,
+		.pitch = len * 2U / 3U,
+	};
+
+	return ili9163c_write_display(dev, buf, &mipi_desc);
+}
+
+/*
+ * Pack pixels two per three bytes, R1G1 B1R2 G2B2. Pairs span rows and calls, an
+ * odd pixel is kept until the next one or until ili9163c_rgb444_flush().
+ */
+static int ili9163c_write_rgb444(const struct device *dev, uint8_t *bounce, size_t bounce_size,
+				 const uint8_t *buf, const struct display_buffer_descriptor *desc,
+				 uint16_t rows)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	size_t bytes_per_pixel = ILI9163C_BYTES_PER_PIXEL(data);
+	size_t len = 0U;
+
+	int r;
+	uint16_t px;
+
+	for (uint16_t row = 0U; row < rows; row++) {
+		const uint8_t *src = &buf[row * desc->pitch * bytes_per_pixel];
+
+		for (uint16_t col = 0U; col < desc->width; col++) {
+			px = ili9163c_rgb444(src, bytes_per_pixel);
+			src += bytes_per_pixel;
+
+			if (!data->rgb444_odd) {
+				data->rgb444_pending = px;
+				data->rgb444_odd = true;
+				continue;
+			}
+
+			bounce[len++] = data->rgb444_pending >> 4;
+			bounce[len++] = (data->rgb444_pending << 4) | (px >> 8);
+			bounce[len++] = px;
+			data->rgb444_odd = false;
+
+			if (len + 3U > bounce_size) {
+				r = ili9163c_write_rgb444_bytes(dev, bounce, len);
+				if (r < 0) {
+					return r;
+				}
+
+				len = 0U;
+			}
+		}
+	}
+
+	if (len > 0U) {
+		return ili9163c_write_rgb444_bytes(dev, bounce, len);
+	}
+
+	return 0;
+}
+
+/* End the RAMWR stream: the controller stores the odd pixel once its 12 bits are received. */
+static int ili9163c_rgb444_flush(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	uint8_t tail[2];
+
+	if (!data->rgb444_odd) {
+		return 0;
+	}
+
+	tail[0] = data->rgb444_pending >> 4;
+	tail[1] = data->rgb444_pending << 4;
+	data->rgb444_odd = false;
+
+	return ili9163c_write_rgb444_bytes(dev, tail, sizeof(tail));
+}
+
+/* Not inlined, so that the line is only on the stack when no pool buffer is free. */
+static __noinline int ili9163c_write_rows_rgb444_line(const struct device *dev, const uint8_t *buf,
+						      const struct display_buffer_descriptor *desc,
+						      uint16_t rows)
+{
+	uint8_t line[ILI9163C_RGB444_LINE_SIZE] __aligned(4);
+
+	return ili9163c_write_rgb444(dev, line, sizeof(line), buf, desc, rows);
+}
+
+static int ili9163c_write_rows_rgb444(const struct device *dev, const uint8_t *buf,
+				      const struct display_buffer_descriptor *desc, uint16_t rows)
+{
+#ifdef CONFIG_ILI9163C_BUF_POOL
+	uint8_t *bounce = ili9163c_buf_acquire(CONFIG_ILI9163C_BUF_SIZE);
+
+	if (bounce != NULL) {
+		int r = ili9163c_write_rgb444(dev, bounce, CONFIG_ILI9163C_BUF_SIZE, buf, desc,
+					      rows);
+
+		ili9163c_buf_release(bounce);
+		return r;
+	}
+#endif
+
+	return ili9163c_write_rows_rgb444_line(dev, buf, desc, rows);
+}
+#endif
+
+static int ili9163c_write_rows(const struct device *dev, const uint8_t *buf,
+			       const struct display_buffer_descriptor *desc, uint16_t rows)
+{
+	struct ili9163c_data *data __maybe_unused = ILI9163C_DEV_DATA(dev);
 	struct display_buffer_descriptor mipi_desc;
 
 	int r;
-	const uint8_t *write_data_start = (const uint8_t *)buf;
 	uint16_t write_cnt;
 	uint16_t nbr_of_writes;
-	uint16_t write_h;
 
-	__ASSERT(desc->width <= desc->pitch, "Pitch is smaller than width");
-	__ASSERT((desc->pitch * data->bytes_per_pixel * desc->height) <= desc->buf_size,
-		 "Input buffer to small");
+#ifdef CONFIG_ILI9163C_RGB444
+	if (ILI9163C_IS_RGB444(data)) {
+		return ili9163c_write_rows_rgb444(dev, buf, desc, rows);
+	}
+#endif
 
-	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y)", desc->width, desc->height, x, y);
-	r = ili9163c_set_mem_area(dev, x, y, desc->width, desc->height);
-	if (r < 0) {
-		return r;
+#ifdef CONFIG_ILI9163C_BUF_POOL
+	/* Packing pays off from two rows per buffer, without a free buffer send row by row. */
+	if ((desc->pitch > desc->width) && (rows > 1U) &&
+	    (2U * desc->width * ILI9163C_BYTES_PER_PIXEL(data) <= CONFIG_ILI9163C_BUF_SIZE)) {
+		uint8_t *bounce = ili9163c_buf_acquire(CONFIG_ILI9163C_BUF_SIZE);
+
+		if (bounce != NULL) {
+			r = ili9163c_write_packed(dev, bounce, buf, desc, rows);
+			ili9163c_buf_release(bounce);
+			return r;
+		}
 	}
+#endif
 
 	if (desc->pitch > desc->width) {
-		write_h = 1U;
-		nbr_of_writes = desc->height;
+		nbr_of_writes = rows;
 		mipi_desc.height = 1;
-		mipi_desc.buf_size = desc->pitch * data->bytes_per_pixel;
+		mipi_desc.buf_size = desc->pitch * ILI9163C_BYTES_PER_PIXEL(data);
 	} else {
-		write_h = desc->height;
-		mipi_desc.height = desc->height;
-		mipi_desc.buf_size = desc->width * data->bytes_per_pixel * write_h;
 		nbr_of_writes = 1U;
+		mipi_desc.height = rows;
+		mipi_desc.buf_size = desc->width * ILI9163C_BYTES_PER_PIXEL(data) * rows;
 	}
 
 	mipi_desc.width = desc->width;
 	mipi_desc.pitch = desc->width;
 
-	r = ili9163c_transmit(dev, ILI9163C_RAMWR, NULL, 0);
+	for (write_cnt = 0U; write_cnt < nbr_of_writes; ++write_cnt) {
+		r = ili9163c_write_display(dev, buf, &mipi_desc);
+		if (r < 0) {
+			return r;
+		}
+
+		buf += desc->pitch * ILI9163C_BYTES_PER_PIXEL(data);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+/* Let pending urgent writes through, then resume the interrupted write on the remaining rows. */
+static int ili9163c_write_yield(const struct device *dev, const uint16_t x, const uint16_t y,
+				const uint16_t w, const uint16_t h)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+
+	if (atomic_get(&data->urgent_pending) == 0) {
+		return 0;
+	}
+
+	data->write_stats.preemptions++;
+
+#ifdef CONFIG_ILI9163C_RGB444
+	r = ili9163c_rgb444_flush(dev);
 	if (r < 0) {
 		return r;
 	}
+#endif
 
-	for (write_cnt = 0U; write_cnt < nbr_of_writes; ++write_cnt) {
-		r = mipi_dbi_write_display(config->mipi_dev, &config->dbi_config, write_data_start,
-					   &mipi_desc, data->pixel_format);
+	while (atomic_get(&data->urgent_pending) > 0) {
+		k_condvar_wait(&data->write_cond, &data->lock, K_FOREVER);
+	}
+
+	r = ili9163c_set_mem_area(dev, x, y, w, h);
+	if (r < 0) {
+		return r;
+	}
+
+	return ili9163c_transmit(dev, ILI9163C_RAMWR, NULL, 0);
+}
+
+static void ili9163c_write_done(const struct device *dev, enum ili9163c_write_priority priority,
+				uint32_t start)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	struct ili9163c_write_latency *latency = &data->write_stats.latency[priority];
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	latency->count++;
+	latency->total_cycles += cycles;
+	latency->max_cycles = MAX(latency->max_cycles, cycles);
+
+	if (priority == ILI9163C_WRITE_PRIORITY_URGENT) {
+		k_condvar_broadcast(&data->write_cond);
+	}
+}
+#endif
+
+int ili9163c_write_direct(const struct device *dev, const uint16_t x, const uint16_t y,
+			  const struct display_buffer_descriptor *desc, const void *buf)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+	const uint8_t *write_data_start = (const uint8_t *)buf;
+	uint16_t chunk_h = desc->height;
+	uint16_t row;
+
+	__ASSERT(desc->width <= desc->pitch, "Pitch is smaller than width");
+	__ASSERT((desc->pitch * ILI9163C_BYTES_PER_PIXEL(data) * desc->height) <= desc->buf_size,
+		 "Input buffer to small");
+
+	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y)", desc->width, desc->height, x, y);
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	uint32_t start = k_cycle_get_32();
+	enum ili9163c_write_priority priority =
+		(desc->width * desc->height <= CONFIG_ILI9163C_WRITE_URGENT_PIXELS)
+			? ILI9163C_WRITE_PRIORITY_URGENT
+			: ILI9163C_WRITE_PRIORITY_NORMAL;
+
+	if (priority == ILI9163C_WRITE_PRIORITY_URGENT) {
+		atomic_inc(&data->urgent_pending);
+	} else {
+		chunk_h = MIN(desc->height, CONFIG_ILI9163C_WRITE_CHUNK_ROWS);
+	}
+#endif
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	if (priority == ILI9163C_WRITE_PRIORITY_URGENT) {
+		atomic_dec(&data->urgent_pending);
+	}
+#endif
+
+	r = ili9163c_set_mem_area(dev, x, y, desc->width, desc->height);
+	if (r < 0) {
+		goto out;
+	}
+
+	r = ili9163c_transmit(dev, ILI9163C_RAMWR, NULL, 0);
+	if (r < 0) {
+		goto out;
+	}
+
+	for (row = 0U; row < desc->height; row += chunk_h) {
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+		if (row > 0U) {
+			r = ili9163c_write_yield(dev, x, y + row, desc->width, desc->height - row);
+			if (r < 0) {
+				goto out;
+			}
+		}
+
+		data->write_stats.chunks++;
+#endif
+
+		r = ili9163c_write_rows(dev, write_data_start, desc,
+					MIN(chunk_h, desc->height - row));
 		if (r < 0) {
-			return r;
+			goto out;
 		}
 
-		write_data_start += desc->pitch * data->bytes_per_pixel;
+		write_data_start += chunk_h * desc->pitch * ILI9163C_BYTES_PER_PIXEL(data);
 	}
 
-	return 0;
+#ifdef CONFIG_ILI9163C_RGB444
+	r = ili9163c_rgb444_flush(dev);
+	if (r < 0) {
+		goto out;
+	}
+#endif
+
+#ifdef CONFIG_ILI9163C_WRITE_HOOK
+	if (data->write_hook != NULL) {
+		data->write_hook(dev, x, y, desc, buf, ILI9163C_CURRENT_PIXEL_FORMAT(data),
+				 data->write_hook_user_data);
+	}
+#endif
+
+out:
+#ifdef CONFIG_ILI9163C_RGB444
+	/* A failed write must not leak its odd pixel into the next one. */
+	data->rgb444_odd = false;
+#endif
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	ili9163c_write_done(dev, priority, start);
+#endif
+
+	k_mutex_unlock(&data->lock);
+
+	return r;
+}
+
+static int ili9163c_write(const struct device *dev, const uint16_t x, const uint16_t y,
+			  const struct display_buffer_descriptor *desc, const void *buf)
+{
+#ifdef CONFIG_ILI9163C_PRESENT
+	int r;
+
+	/* Direct writes skip the shadow framebuffer, checked again under the lock. */
+	if (ILI9163C_DEV_DATA(dev)->present_running) {
+		r = ili9163c_present_write(dev, x, y, desc, buf);
+		if (r != -EAGAIN) {
+			return r;
+		}
+	}
+#endif
+
+	return ili9163c_write_direct(dev, x, y, desc, buf);
+}
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+void ili9163c_get_write_stats(const struct device *dev, struct ili9163c_write_stats *stats)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	*stats = data->write_stats;
+	k_mutex_unlock(&data->lock);
+}
+
+void ili9163c_reset_write_stats(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	memset(&data->write_stats, 0, sizeof(data->write_stats));
+	k_mutex_unlock(&data->lock);
+}
+#endif
+
+#ifdef CONFIG_ILI9163C_WRITE_HOOK
+void ili9163c_set_write_hook(const struct device *dev, ili9163c_write_hook_t hook,
+			     void *user_data)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	data->write_hook = hook;
+	data->write_hook_user_data = user_data;
+	k_mutex_unlock(&data->lock);
 }
+#endif
 
 static int ili9163c_set_brightness(const struct device *dev, uint8_t brightness)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
 	int r;
 
+	if (config->pwm.dev == NULL) {
+		return -ENOTSUP;
+	}
+
 	r = pwm_set_dt(&config->pwm, ILI9163C_BACKLIGHT_PERIOD_NS,
 		       ILI9163C_BACKLIGHT_PERIOD_NS * brightness / ILI9163C_BACKLIGHT_RESOLUTION);
 
 	return r;
 }
 
+static int ili9163c_set_display_on(const struct device *dev, bool on)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	r = ili9163c_transmit(dev, on ? ILI9163C_DISPON : ILI9163C_DISPOFF, NULL, 0);
+	if (r == 0) {
+		data->display_on = on;
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return r;
+}
+
 static int ili9163c_display_blanking_off(const struct device *dev)
 {
 	LOG_DBG("Turning display blanking off");
-	return ili9163c_transmit(dev, ILI9163C_DISPON, NULL, 0);
+	return ili9163c_set_display_on(dev, true);
 }
 
 static int ili9163c_display_blanking_on(const struct device *dev)
 {
 	LOG_DBG("Turning display blanking on");
-	return ili9163c_transmit(dev, ILI9163C_DISPOFF, NULL, 0);
+	return ili9163c_set_display_on(dev, false);
 }
 
 static int ili9163c_set_pixel_format(const struct device *dev,
 				     const enum display_pixel_format pixel_format)
 {
-	struct ili9163c_data *data = dev->data;
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
 
 	int r;
 	uint8_t tx_data;
 	uint8_t bytes_per_pixel;
 
-	if (pixel_format == PIXEL_FORMAT_RGB_565) {
+	if (ILI9163C_HAS_PIXEL_FORMAT(RGB565) && (pixel_format == PIXEL_FORMAT_RGB_565)) {
 		bytes_per_pixel = 2U;
 		tx_data = ILI9163C_PIXSET_RGB_16_BIT | ILI9163C_PIXSET_MCU_16_BIT;
-	} else if (pixel_format == PIXEL_FORMAT_RGB_888) {
+	} else if (ILI9163C_HAS_PIXEL_FORMAT(RGB888) && (pixel_format == PIXEL_FORMAT_RGB_888)) {
 		bytes_per_pixel = 3U;
 		tx_data = ILI9163C_PIXSET_RGB_18_BIT | ILI9163C_PIXSET_MCU_18_BIT;
 	} else {
@@ -172,54 +597,144 @@ static int ili9163c_set_pixel_format(const struct device *dev,
 		return -ENOTSUP;
 	}
 
+	if (ILI9163C_IS_RGB444(data)) {
+		/* Pixels of either format are packed to 12 bits on the bus. */
+		tx_data = ILI9163C_PIXSET_RGB_12_BIT | ILI9163C_PIXSET_MCU_12_BIT;
+	}
+
+#ifdef CONFIG_ILI9163C_PRESENT
+	/* The shadow framebuffer layout depends on the pixel format. */
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (data->present_running) {
+		k_mutex_unlock(&data->present_lock);
+		return -EBUSY;
+	}
+#endif
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
 	r = ili9163c_transmit(dev, ILI9163C_PIXSET, &tx_data, 1U);
-	if (r < 0) {
-		return r;
+	if (r == 0) {
+		data->pixel_format = pixel_format;
+		data->bytes_per_pixel = bytes_per_pixel;
+		data->pixset = tx_data;
 	}
 
-	data->pixel_format = pixel_format;
-	data->bytes_per_pixel = bytes_per_pixel;
+	k_mutex_unlock(&data->lock);
 
-	return 0;
+#ifdef CONFIG_ILI9163C_PRESENT
+	k_mutex_unlock(&data->present_lock);
+#endif
+
+	return r;
+}
+
+#ifdef CONFIG_ILI9163C_RGB444
+int ili9163c_set_rgb444(const struct device *dev, bool enable)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+	uint8_t tx_data;
+
+	if (IS_ENABLED(CONFIG_ILI9163C_FIXED_CONFIG)) {
+		return (enable == ILI9163C_IS_RGB444(data)) ? 0 : -ENOTSUP;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (enable) {
+		tx_data = ILI9163C_PIXSET_RGB_12_BIT | ILI9163C_PIXSET_MCU_12_BIT;
+	} else if (ILI9163C_CURRENT_PIXEL_FORMAT(data) == PIXEL_FORMAT_RGB_565) {
+		tx_data = ILI9163C_PIXSET_RGB_16_BIT | ILI9163C_PIXSET_MCU_16_BIT;
+	} else {
+		tx_data = ILI9163C_PIXSET_RGB_18_BIT | ILI9163C_PIXSET_MCU_18_BIT;
+	}
+
+	r = ili9163c_transmit(dev, ILI9163C_PIXSET, &tx_data, 1U);
+	if (r == 0) {
+		data->rgb444 = enable;
+		data->pixset = tx_data;
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return r;
+}
+
+bool ili9163c_get_rgb444(const struct device *dev)
+{
+	return ILI9163C_IS_RGB444(ILI9163C_DEV_DATA(dev));
 }
+#endif
 
 static int ili9163c_set_orientation(const struct device *dev,
 				    const enum display_orientation orientation)
 {
-	struct ili9163c_data *data = dev->data;
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
 
 	int r;
 	uint8_t tx_data = ILI9163C_MADCTL_BGR;
-	if (orientation == DISPLAY_ORIENTATION_NORMAL) {
+	if (ILI9163C_HAS_ROTATION(0) && (orientation == DISPLAY_ORIENTATION_NORMAL)) {
 		/* Do nothing */
-	} else if (orientation == DISPLAY_ORIENTATION_ROTATED_90) {
+	} else if (ILI9163C_HAS_ROTATION(90) && (orientation == DISPLAY_ORIENTATION_ROTATED_90)) {
 		tx_data |= ILI9163C_MADCTL_MV | ILI9163C_MADCTL_MX;
-	} else if (orientation == DISPLAY_ORIENTATION_ROTATED_180) {
+	} else if (ILI9163C_HAS_ROTATION(180) &&
+		   (orientation == DISPLAY_ORIENTATION_ROTATED_180)) {
 		tx_data |= ILI9163C_MADCTL_MX | ILI9163C_MADCTL_MY;
-	} else if (orientation == DISPLAY_ORIENTATION_ROTATED_270) {
+	} else if (ILI9163C_HAS_ROTATION(270) &&
+		   (orientation == DISPLAY_ORIENTATION_ROTATED_270)) {
 		tx_data |= ILI9163C_MADCTL_MV | ILI9163C_MADCTL_MY;
+	} else {
+		LOG_ERR("Unsupported orientation");
+		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_ILI9163C_PRESENT
+	/* The shadow framebuffer layout depends on the orientation. */
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (data->present_running) {
+		k_mutex_unlock(&data->present_lock);
+		return -EBUSY;
+	}
+#endif
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
 	r = ili9163c_transmit(dev, ILI9163C_MADCTL, &tx_data, 1U);
-	if (r < 0) {
-		return r;
+	if (r == 0) {
+		data->orientation = orientation;
+		data->madctl = tx_data;
 	}
 
-	data->orientation = orientation;
+	k_mutex_unlock(&data->lock);
 
-	return 0;
+#ifdef CONFIG_ILI9163C_PRESENT
+	k_mutex_unlock(&data->present_lock);
+#endif
+
+	return r;
 }
 
 static void ili9163c_get_capabilities(const struct device *dev,
 				      struct display_capabilities *capabilities)
 {
-	struct ili9163c_data *data = dev->data;
-	const struct ili9163c_config *config = dev->config;
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
 
 	memset(capabilities, 0, sizeof(struct display_capabilities));
 
-	capabilities->supported_pixel_formats = PIXEL_FORMAT_RGB_565 | PIXEL_FORMAT_RGB_888;
-	capabilities->current_pixel_format = data->pixel_format;
+	if (ILI9163C_HAS_PIXEL_FORMAT(RGB565)) {
+		capabilities->supported_pixel_formats |= PIXEL_FORMAT_RGB_565;
+	}
+
+	if (ILI9163C_HAS_PIXEL_FORMAT(RGB888)) {
+		capabilities->supported_pixel_formats |= PIXEL_FORMAT_RGB_888;
+	}
+
+	capabilities->current_pixel_format = ILI9163C_CURRENT_PIXEL_FORMAT(data);
 
 	if (data->orientation == DISPLAY_ORIENTATION_NORMAL ||
 	    data->orientation == DISPLAY_ORIENTATION_ROTATED_180) {
@@ -235,7 +750,8 @@ static void ili9163c_get_capabilities(const struct device *dev,
 
 static int ili9163c_configure(const struct device *dev)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data __maybe_unused = ILI9163C_DEV_DATA(dev);
 
 	int r;
 	enum display_pixel_format pixel_format;
@@ -246,12 +762,17 @@ static int ili9163c_configure(const struct device *dev)
 		return r;
 	}
 
-	if (config->pixel_format == ILI9163C_PIXEL_FORMAT_RGB565) {
-		pixel_format = PIXEL_FORMAT_RGB_565;
-	} else {
+	if (config->pixel_format == ILI9163C_PIXEL_FORMAT_RGB888) {
 		pixel_format = PIXEL_FORMAT_RGB_888;
+	} else {
+		/* RGB444 panels take RGB565 pixels, packed by the driver. */
+		pixel_format = PIXEL_FORMAT_RGB_565;
 	}
 
+#ifdef CONFIG_ILI9163C_RGB444
+	data->rgb444 = (config->pixel_format == ILI9163C_PIXEL_FORMAT_RGB444);
+#endif
+
 	r = ili9163c_set_pixel_format(dev, pixel_format);
 	if (r < 0) {
 		return r;
@@ -279,9 +800,11 @@ static int ili9163c_configure(const struct device *dev)
 		}
 	}
 
-	r = ili9163c_set_brightness(dev, 255);
-	if (r < 0) {
-		return r;
+	if (config->pwm.dev != NULL) {
+		r = ili9163c_set_brightness(dev, 255);
+		if (r < 0) {
+			return r;
+		}
 	}
 
 	return 0;
@@ -289,7 +812,7 @@ static int ili9163c_configure(const struct device *dev)
 
 int ili9163c_regs_init(const struct device *dev)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
 	const struct ili9163c_regs *regs = config->regs;
 
 	int r;
@@ -369,13 +892,263 @@ int ili9163c_regs_init(const struct device *dev)
 	return 0;
 }
 
+#ifdef CONFIG_ILI9163C_RESYNC
+static int ili9163c_read_reg(const struct device *dev, uint8_t cmd, uint8_t *value)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+
+#ifdef CONFIG_ILI9163C_RECORD
+	ili9163c_record(dev, ILI9163C_RECORD_READ, cmd, NULL, 1U);
+#endif
+
+	return mipi_dbi_command_read(config->mipi_dev, &config->dbi_config, &cmd, 1U, value, 1U);
+}
+
+static uint32_t ili9163c_check(const struct device *dev, int *err)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	uint32_t diverged = 0U;
+	uint8_t value;
+
+	*err = ili9163c_read_reg(dev, ILI9163C_RDDPM, &value);
+	if (*err < 0) {
+		return 0U;
+	}
+
+	/* A controller back in sleep mode went through a reset: nothing can be trusted. */
+	if ((value & ILI9163C_RDDPM_SLPOUT) == 0U) {
+		return ILI9163C_RESYNC_RESET;
+	}
+
+	if (((value & ILI9163C_RDDPM_DISPON) != 0U) != data->display_on) {
+		diverged |= ILI9163C_RESYNC_DISPLAY;
+	}
+
+	*err = ili9163c_read_reg(dev, ILI9163C_RDDMADCTL, &value);
+	if (*err < 0) {
+		return 0U;
+	}
+
+	if (value != data->madctl) {
+		diverged |= ILI9163C_RESYNC_MADCTL;
+	}
+
+	*err = ili9163c_read_reg(dev, ILI9163C_RDDCOLMOD, &value);
+	if (*err < 0) {
+		return 0U;
+	}
+
+	if ((value & ILI9163C_PIXSET_MASK) != data->pixset) {
+		diverged |= ILI9163C_RESYNC_PIXSET;
+	}
+
+	*err = ili9163c_read_reg(dev, ILI9163C_RDDIM, &value);
+	if (*err < 0) {
+		return 0U;
+	}
+
+	if (((value & ILI9163C_RDDIM_INVON) != 0U) != config->inversion) {
+		diverged |= ILI9163C_RESYNC_INVERSION;
+	}
+
+	return diverged;
+}
+
+static int ili9163c_replay(const struct device *dev, uint32_t diverged)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+
+	if ((diverged & ILI9163C_RESYNC_RESET) != 0U) {
+		r = config->regs_init_fn(dev);
+		if (r < 0) {
+			return r;
+		}
+
+#ifdef CONFIG_ILI9163C_READ
+		/* The color lookup table written at init is lost on reset as well. */
+		r = ili9163c_transmit(dev, ILI9163C_RGBSET, ili9163c_rgb_lut,
+				      sizeof(ili9163c_rgb_lut));
+		if (r < 0) {
+			return r;
+		}
+#endif
+
+		diverged = ILI9163C_RESYNC_RESET | ILI9163C_RESYNC_MADCTL | ILI9163C_RESYNC_PIXSET |
+			   ILI9163C_RESYNC_DISPLAY;
+		if (config->inversion) {
+			diverged |= ILI9163C_RESYNC_INVERSION;
+		}
+	}
+
+	if ((diverged & ILI9163C_RESYNC_MADCTL) != 0U) {
+		r = ili9163c_transmit(dev, ILI9163C_MADCTL, &data->madctl, 1U);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	if ((diverged & ILI9163C_RESYNC_PIXSET) != 0U) {
+		r = ili9163c_transmit(dev, ILI9163C_PIXSET, &data->pixset, 1U);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	if ((diverged & ILI9163C_RESYNC_INVERSION) != 0U) {
+		r = ili9163c_transmit(dev, config->inversion ? ILI9163C_DINVON : ILI9163C_DINVOFF,
+				      NULL, 0U);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	if ((diverged & ILI9163C_RESYNC_RESET) != 0U) {
+		r = ili9163c_exit_sleep(dev);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	if ((diverged & ILI9163C_RESYNC_DISPLAY) != 0U) {
+		r = ili9163c_transmit(dev, data->display_on ? ILI9163C_DISPON : ILI9163C_DISPOFF,
+				      NULL, 0U);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+
+int ili9163c_resync(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	struct ili9163c_resync_stats *stats = &data->resync_stats;
+	ili9163c_resync_cb_t cb;
+	void *user_data;
+
+	int r;
+	uint32_t diverged;
+	uint32_t start;
+	uint32_t checked;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	start = k_cycle_get_32();
+	diverged = ili9163c_check(dev, &r);
+	checked = k_cycle_get_32();
+
+	stats->checks++;
+	stats->check_cycles = checked - start;
+
+	if ((r == 0) && (diverged != 0U)) {
+		LOG_WRN("Controller state diverged (0x%02x), replaying", diverged);
+
+		/* The read commands ended any RAMWR, and a reset cleared the window. */
+		data->window_valid = false;
+
+		r = ili9163c_replay(dev, diverged);
+
+		stats->recoveries++;
+		stats->last_diverged = diverged;
+		stats->recovery_cycles = k_cycle_get_32() - checked;
+		stats->max_recovery_cycles =
+			MAX(stats->max_recovery_cycles, stats->recovery_cycles);
+	}
+
+	/* Called without the lock, so that the callback can use the display API. */
+	cb = data->resync_cb;
+	user_data = data->resync_user_data;
+
+	k_mutex_unlock(&data->lock);
+
+	if (r < 0) {
+		return r;
+	}
+
+	if ((diverged != 0U) && (cb != NULL)) {
+		cb(dev, diverged, user_data);
+	}
+
+	return diverged;
+}
+
+void ili9163c_set_resync_callback(const struct device *dev, ili9163c_resync_cb_t cb,
+				  void *user_data)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	data->resync_cb = cb;
+	data->resync_user_data = user_data;
+	k_mutex_unlock(&data->lock);
+}
+
+void ili9163c_get_resync_stats(const struct device *dev, struct ili9163c_resync_stats *stats)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	*stats = data->resync_stats;
+	k_mutex_unlock(&data->lock);
+}
+
+static void ili9163c_resync_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ili9163c_data *data = CONTAINER_OF(dwork, struct ili9163c_data, resync_work);
+
+	int r;
+
+	r = ili9163c_resync(data->dev);
+	if (r == -ENOTSUP) {
+		LOG_WRN("Status can not be read back, periodic resync disabled");
+		return;
+	} else if (r < 0) {
+		LOG_ERR("Could not resync display (%d)", r);
+	}
+
+	k_work_reschedule_for_queue(&ili9163c_resync_workq, dwork,
+				    K_MSEC(CONFIG_ILI9163C_RESYNC_PERIOD_MS));
+}
+
+static int ili9163c_resync_workq_init(void)
+{
+	k_work_queue_init(&ili9163c_resync_workq);
+	k_work_queue_start(&ili9163c_resync_workq, ili9163c_resync_stack,
+			   K_THREAD_STACK_SIZEOF(ili9163c_resync_stack),
+			   CONFIG_ILI9163C_RESYNC_PRIORITY, NULL);
+
+	return 0;
+}
+
+SYS_INIT(ili9163c_resync_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif
+
 static int ili9163c_init(const struct device *dev)
 {
-	const struct ili9163c_config *config = dev->config;
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
 
 	int r;
 
-	if (!pwm_is_ready_dt(&config->pwm)) {
+	k_mutex_init(&data->lock);
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	k_condvar_init(&data->write_cond);
+#endif
+#ifdef CONFIG_ILI9163C_PRESENT
+	ili9163c_present_init(dev);
+#endif
+#ifdef CONFIG_ILI9163C_RECORD
+	k_mutex_init(&data->record_lock);
+#endif
+
+	if ((config->pwm.dev != NULL) && !pwm_is_ready_dt(&config->pwm)) {
 		LOG_ERR("PWM device is not ready");
 		return -ENODEV;
 	}
@@ -413,6 +1186,15 @@ static int ili9163c_init(const struct device *dev)
 		return r;
 	}
 
+#ifdef CONFIG_ILI9163C_RESYNC
+	data->dev = dev;
+	k_work_init_delayable(&data->resync_work, ili9163c_resync_work_handler);
+	if (CONFIG_ILI9163C_RESYNC_PERIOD_MS > 0) {
+		k_work_schedule_for_queue(&ili9163c_resync_workq, &data->resync_work,
+					  K_MSEC(CONFIG_ILI9163C_RESYNC_PERIOD_MS));
+	}
+#endif
+
 	return 0;
 }
 
@@ -431,10 +1213,25 @@ static const struct display_driver_api ili9163c_api = {
 
 #define INST_DT_ILI9163C(n) DT_INST(n, ilitek_ili9163c)
 
+/* Sized for the devicetree pixel format: 3 bytes per pixel in RGB888, 2 otherwise. */
+#define ILI9163C_SHADOW_SIZE(n)                                                                    \
+	(DT_INST_PROP(n, width) * DT_INST_PROP(n, height) *                                        \
+	 ((DT_INST_PROP(n, pixel_format) == ILI9163C_PIXEL_FORMAT_RGB888) ? 3U : 2U))
+
+#define ILI9163C_SHADOW_DEFINE(n)                                                                  \
+	IF_ENABLED(DT_INST_PROP(n, present_shadow),                                                \
+		   (static uint8_t ili9163c_shadow_##n[ILI9163C_SHADOW_SIZE(n)];))
+
 #define ILI9163C_INIT(n)                                                                           \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_ILI9163C_RGB444) ||                                         \
+			     (DT_INST_PROP(n, pixel_format) != ILI9163C_PIXEL_FORMAT_RGB444),      \
+		     "RGB444 pixel format requires CONFIG_ILI9163C_RGB444");                       \
+                                                                                                   \
 	ILI9163C_REGS_INIT(n);                                                                     \
                                                                                                    \
-	static const struct ili9163c_config ili9163c_config_##n = {                                \
+	IF_ENABLED(CONFIG_ILI9163C_PRESENT, (ILI9163C_SHADOW_DEFINE(n)))                           \
+                                                                                                   \
+	ILI9163C_INST_STORAGE const struct ili9163c_config ili9163c_config_##n = {                 \
 		.mipi_dev = DEVICE_DT_GET(DT_PARENT(DT_INST(n, DT_DRV_COMPAT))),                   \
 		.dbi_config =                                                                      \
 			{                                                                          \
@@ -447,12 +1244,15 @@ static const struct display_driver_api ili9163c_api = {
 		.x_resolution = DT_INST_PROP(n, width),                                            \
 		.y_resolution = DT_INST_PROP(n, height),                                           \
 		.inversion = DT_INST_PROP(n, display_inversion),                                   \
-		.pwm = PWM_DT_SPEC_INST_GET(n),                                                    \
+		.pwm = PWM_DT_SPEC_INST_GET_OR(n, {0}),                                            \
 		.regs = &ili9163c_regs_##n,                                                        \
 		.regs_init_fn = ili9163c_regs_init,                                                \
+		IF_ENABLED(CONFIG_ILI9163C_PRESENT,                                                \
+			   (.shadow = COND_CODE_1(DT_INST_PROP(n, present_shadow),                 \
+						  (ili9163c_shadow_##n), (NULL)),))                \
 	};                                                                                         \
                                                                                                    \
-	static struct ili9163c_data ili9163c_data_##n;                                             \
+	ILI9163C_INST_STORAGE struct ili9163c_data ili9163c_data_##n;                              \
                                                                                                    \
 	DEVICE_DT_INST_DEFINE(n, ili9163c_init, NULL, &ili9163c_data_##n, &ili9163c_config_##n,    \
 			      POST_KERNEL, CONFIG_DISPLAY_INIT_PRIORITY, &ili9163c_api);
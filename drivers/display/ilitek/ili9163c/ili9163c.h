@@ -10,9 +10,7 @@
 #include <zephyr/drivers/pwm.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/device.h>
-
-#define ILI9163C_PIXEL_FORMAT_RGB565 0U
-#define ILI9163C_PIXEL_FORMAT_RGB888 1U
+#include <zephyr/dt-bindings/display/ili9163c.h>
 
 /* Backlight config */
 #define ILI9163C_BACKLIGHT_PERIOD_NS  1000000
@@ -20,7 +18,12 @@
 
 /* Commands/registers. */
 #define ILI9163C_SWRESET    0x01
+#define ILI9163C_RDDPM      0x0A
+#define ILI9163C_RDDMADCTL  0x0B
+#define ILI9163C_RDDCOLMOD  0x0C
+#define ILI9163C_RDDIM      0x0D
 #define ILI9163C_SLPOUT     0x11
+#define ILI9163C_DINVOFF    0x20
 #define ILI9163C_DINVON     0x21
 #define ILI9163C_GAMSET     0x26
 #define ILI9163C_DISPOFF    0x28
@@ -41,11 +44,25 @@
 #define ILI9163C_MADCTL_BGR BIT(3U)
 #define ILI9163C_MADCTL_MH  BIT(2U)
 
+/* RDDPM register fields. */
+#define ILI9163C_RDDPM_SLPOUT BIT(4U)
+#define ILI9163C_RDDPM_DISPON BIT(2U)
+
+/* RDDIM register fields. */
+#define ILI9163C_RDDIM_INVON BIT(5U)
+
 /* PIXSET register fields. */
 #define ILI9163C_PIXSET_RGB_18_BIT 0x60
 #define ILI9163C_PIXSET_RGB_16_BIT 0x50
+#define ILI9163C_PIXSET_RGB_12_BIT 0x30
 #define ILI9163C_PIXSET_MCU_18_BIT 0x06
 #define ILI9163C_PIXSET_MCU_16_BIT 0x05
+#define ILI9163C_PIXSET_MCU_12_BIT 0x03
+/* PIXSET bits read back by RDDCOLMOD, the others are reserved. */
+#define ILI9163C_PIXSET_MASK       0x77
+
+/** RGB444 packing buffer without a free pool buffer: 128 pixels packed, 2 pixels in 3 bytes. */
+#define ILI9163C_RGB444_LINE_SIZE 192U
 
 /* Commands/registers. */
 #define ILI9163C_GAMSET   0x26
@@ -75,6 +92,17 @@
 #define ILI9163C_GAMADJ_LEN   1U
 #define ILI9163C_MADCTL_LEN   1U
 
+/* FRMCTR1 register fields. */
+#define ILI9163C_FRMCTR1_DIVA_MASK 0x1FU
+#define ILI9163C_FRMCTR1_VPA_MASK  0x3FU
+
+/**
+ * Frame timing, ref. 8.3.1 of ILI9163C manual: the panel scans the GRAM lines
+ * plus VPA porch lines, each taking DIVA periods of the divided oscillator.
+ */
+#define ILI9163C_FOSC_HZ   150000U
+#define ILI9163C_GRAM_ROWS 162U
+
 /** Command/data GPIO level for commands. */
 #define ILI9163C_CMD  1U
 /** Command/data GPIO level for data. */
@@ -100,6 +128,9 @@ struct ili9163c_config {
 	struct pwm_dt_spec pwm;
 	const void *regs;
 	int (*regs_init_fn)(const struct device *dev);
+#ifdef CONFIG_ILI9163C_PRESENT
+	uint8_t *shadow;
+#endif
 };
 
 /** ILI9163C registers to be initialized. */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+/* Buffers never share a cache line, so cache maintenance on one never corrupts another. */
+#define ILI9163C_BUF_STRIDE ROUND_UP(CONFIG_ILI9163C_BUF_SIZE, CONFIG_ILI9163C_BUF_ALIGN)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_ILI9163C_BUF_ALIGN),
+	     "CONFIG_ILI9163C_BUF_ALIGN must be a power of two");
+BUILD_ASSERT(CONFIG_ILI9163C_BUF_COUNT <= 32, "Buffers are tracked in a 32-bit bitmap");
+
+static uint8_t ili9163c_bufs[CONFIG_ILI9163C_BUF_COUNT][ILI9163C_BUF_STRIDE]
+	__aligned(CONFIG_ILI9163C_BUF_ALIGN);
+
+/* Bit n is set while buffer n is in use. */
+static atomic_t ili9163c_buf_used;
+static atomic_t ili9163c_buf_high_watermark;
+static atomic_t ili9163c_buf_failures;
+
+void *ili9163c_buf_acquire(size_t size)
+{
+	atomic_val_t used;
+	atomic_val_t in_use;
+	atomic_val_t max;
+	int index;
+
+	if (size > CONFIG_ILI9163C_BUF_SIZE) {
+		atomic_inc(&ili9163c_buf_failures);
+		return NULL;
+	}
+
+	do {
+		used = atomic_get(&ili9163c_buf_used);
+		index = find_lsb_set(~(uint32_t)used) - 1;
+		if ((index < 0) || (index >= CONFIG_ILI9163C_BUF_COUNT)) {
+			atomic_inc(&ili9163c_buf_failures);
+			return NULL;
+		}
+	} while (!atomic_cas(&ili9163c_buf_used, used, used | BIT(index)));
+
+	in_use = POPCOUNT((uint32_t)used) + 1;
+	do {
+		max = atomic_get(&ili9163c_buf_high_watermark);
+	} while ((in_use > max) && !atomic_cas(&ili9163c_buf_high_watermark, max, in_use));
+
+	return ili9163c_bufs[index];
+}
+
+void ili9163c_buf_release(void *buf)
+{
+	size_t offset = (uint8_t *)buf - &ili9163c_bufs[0][0];
+	size_t index = offset / ILI9163C_BUF_STRIDE;
+
+	__ASSERT((offset % ILI9163C_BUF_STRIDE == 0U) && (index < CONFIG_ILI9163C_BUF_COUNT),
+		 "Not a pool buffer");
+	__ASSERT(atomic_test_bit(&ili9163c_buf_used, index), "Buffer released twice");
+
+	atomic_clear_bit(&ili9163c_buf_used, index);
+}
+
+void ili9163c_buf_get_stats(struct ili9163c_buf_stats *stats)
+{
+	stats->size = CONFIG_ILI9163C_BUF_SIZE;
+	stats->count = CONFIG_ILI9163C_BUF_COUNT;
+	stats->in_use = POPCOUNT((uint32_t)atomic_get(&ili9163c_buf_used));
+	stats->high_watermark = atomic_get(&ili9163c_buf_high_watermark);
+	stats->failures = atomic_get(&ili9163c_buf_failures);
+}
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ilitek_ili9163c_emul
+
+#include "ili9163c.h"
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display/ili9163c_emul.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ILI9163C_EMUL, CONFIG_DISPLAY_LOG_LEVEL);
+
+/** Number of bytes used to store one pixel in the emulated GRAM. */
+#define ILI9163C_EMUL_GRAM_BPP 3U
+
+struct ili9163c_emul_config {
+	struct gpio_dt_spec dc;
+	uint16_t width;
+	uint16_t height;
+	uint8_t *gram;
+};
+
+struct ili9163c_emul_data {
+	/* Command being executed and its parameters. */
+	uint8_t cmd;
+	uint8_t param[4];
+	uint8_t param_len;
+	/* Memory window and write pointer. */
+	uint16_t xs;
+	uint16_t xe;
+	uint16_t ys;
+	uint16_t ye;
+	uint16_t col;
+	uint16_t row;
+	/* Pixel being assembled from the data stream. */
+	uint8_t pix[3];
+	uint8_t pix_len;
+	/* Panel state. */
+	uint8_t madctl;
+	uint8_t pixset;
+	bool inversion;
+	bool sleep_out;
+	bool display_on;
+	/* Modeled bus time not yet consumed, in ns. */
+	uint64_t bus_ns;
+};
+
+static bool ili9163c_emul_is_cmd(const struct ili9163c_emul_config *config)
+{
+	int level = gpio_emul_output_get(config->dc.port, config->dc.pin);
+
+	/* D/C low selects a command, as driven by the MIPI-DBI SPI controller. */
+	if ((config->dc.dt_flags & GPIO_ACTIVE_LOW) != 0U) {
+		return level == 1;
+	}
+
+	return level == 0;
+}
+
+static void ili9163c_emul_reset(const struct emul *target)
+{
+	const struct ili9163c_emul_config *config = target->cfg;
+	struct ili9163c_emul_data *data = target->data;
+
+	memset(data, 0, sizeof(*data));
+	data->xe = config->width - 1U;
+	data->ye = config->height - 1U;
+	data->pixset = ILI9163C_PIXSET_RGB_18_BIT | ILI9163C_PIXSET_MCU_18_BIT;
+}
+
+static void ili9163c_emul_store_pixel(const struct emul *target, uint8_t r, uint8_t g, uint8_t b)
+{
+	const struct ili9163c_emul_config *config = target->cfg;
+	struct ili9163c_emul_data *data = target->data;
+	uint16_t x = data->col;
+	uint16_t y = data->row;
+	uint8_t *px;
+
+	if ((data->madctl & ILI9163C_MADCTL_MV) != 0U) {
+		x = data->row;
+		y = data->col;
+	}
+
+	if ((data->madctl & ILI9163C_MADCTL_MX) != 0U) {
+		x = config->width - 1U - x;
+	}
+
+	if ((data->madctl & ILI9163C_MADCTL_MY) != 0U) {
+		y = config->height - 1U - y;
+	}
+
+	if ((x < config->width) && (y < config->height)) {
+		px = &config->gram[((size_t)y * config->width + x) * ILI9163C_EMUL_GRAM_BPP];
+		px[0] = r;
+		px[1] = g;
+		px[2] = b;
+	}
+
+	/* Advance the write pointer within the CASET/PASET window. */
+	if (data->col < data->xe) {
+		data->col++;
+	} else {
+		data->col = data->xs;
+		data->row = (data->row < data->ye) ? data->row + 1U : data->ys;
+	}
+}
+
+static void ili9163c_emul_ramwr(const struct emul *target, uint8_t byte)
+{
+	struct ili9163c_emul_data *data = target->data;
+	uint16_t rgb565;
+
+	data->pix[data->pix_len++] = byte;
+
+	if ((data->pixset & 0x0FU) == ILI9163C_PIXSET_MCU_16_BIT) {
+		if (data->pix_len < 2U) {
+			return;
+		}
+
+		rgb565 = sys_get_be16(data->pix);
+		ili9163c_emul_store_pixel(target, ((rgb565 >> 11) & 0x1FU) << 3,
+					  ((rgb565 >> 5) & 0x3FU) << 2, (rgb565 & 0x1FU) << 3);
+	} else if ((data->pixset & 0x0FU) == ILI9163C_PIXSET_MCU_12_BIT) {
+		/* 2 pixels in 3 bytes, each stored once its 12 bits are received. */
+		if (data->pix_len == 2U) {
+			ili9163c_emul_store_pixel(target, data->pix[0] & 0xF0U,
+						  (data->pix[0] << 4) & 0xF0U,
+						  data->pix[1] & 0xF0U);
+			return;
+		}
+
+		if (data->pix_len < 3U) {
+			return;
+		}
+
+		ili9163c_emul_store_pixel(target, (data->pix[1] << 4) & 0xF0U,
+					  data->pix[2] & 0xF0U, (data->pix[2] << 4) & 0xF0U);
+	} else {
+		if (data->pix_len < 3U) {
+			return;
+		}
+
+		ili9163c_emul_store_pixel(target, data->pix[0] & 0xFCU, data->pix[1] & 0xFCU,
+					  data->pix[2] & 0xFCU);
+	}
+
+	data->pix_len = 0U;
+}
+
+static void ili9163c_emul_command(const struct emul *target, uint8_t cmd)
+{
+	struct ili9163c_emul_data *data = target->data;
+
+	data->cmd = cmd;
+	data->param_len = 0U;
+	data->pix_len = 0U;
+
+	switch (cmd) {
+	case ILI9163C_SWRESET:
+		ili9163c_emul_reset(target);
+		break;
+	case ILI9163C_SLPOUT:
+		data->sleep_out = true;
+		break;
+	case ILI9163C_DISPON:
+		data->display_on = true;
+		break;
+	case ILI9163C_DISPOFF:
+		data->display_on = false;
+		break;
+	case ILI9163C_DINVON:
+		data->inversion = true;
+		break;
+	case ILI9163C_DINVOFF:
+		data->inversion = false;
+		break;
+	case ILI9163C_RAMWR:
+		data->col = data->xs;
+		data->row = data->ys;
+		break;
+	default:
+		break;
+	}
+}
+
+static void ili9163c_emul_data(const struct emul *target, uint8_t byte)
+{
+	struct ili9163c_emul_data *data = target->data;
+
+	if (data->cmd == ILI9163C_RAMWR) {
+		ili9163c_emul_ramwr(target, byte);
+		return;
+	}
+
+	if (data->param_len >= sizeof(data->param)) {
+		return;
+	}
+
+	data->param[data->param_len++] = byte;
+
+	switch (data->cmd) {
+	case ILI9163C_CASET:
+		if (data->param_len == 4U) {
+			data->xs = sys_get_be16(&data->param[0]);
+			data->xe = sys_get_be16(&data->param[2]);
+		}
+		break;
+	case ILI9163C_PASET:
+		if (data->param_len == 4U) {
+			data->ys = sys_get_be16(&data->param[0]);
+			data->ye = sys_get_be16(&data->param[2]);
+		}
+		break;
+	case ILI9163C_MADCTL:
+		data->madctl = byte;
+		break;
+	case ILI9163C_PIXSET:
+		data->pixset = byte;
+		break;
+	default:
+		break;
+	}
+}
+
+static uint8_t ili9163c_emul_read(const struct emul *target)
+{
+	struct ili9163c_emul_data *data = target->data;
+
+	switch (data->cmd) {
+	case ILI9163C_RDDPM:
+		return (data->sleep_out ? ILI9163C_RDDPM_SLPOUT : 0U) |
+		       (data->display_on ? ILI9163C_RDDPM_DISPON : 0U);
+	case ILI9163C_RDDMADCTL:
+		return data->madctl;
+	case ILI9163C_RDDCOLMOD:
+		return data->pixset;
+	case ILI9163C_RDDIM:
+		return data->inversion ? ILI9163C_RDDIM_INVON : 0U;
+	default:
+		return 0U;
+	}
+}
+
+static void ili9163c_emul_bus_time(const struct emul *target, const struct spi_config *config,
+				   size_t len)
+{
+	struct ili9163c_emul_data *data = target->data;
+
+	if (config->frequency == 0U) {
+		return;
+	}
+
+	/* Model the time the transfer would hold the bus on real hardware. */
+	data->bus_ns += (uint64_t)len * 8U * NSEC_PER_SEC / config->frequency;
+	if (data->bus_ns >= NSEC_PER_USEC) {
+		k_busy_wait(data->bus_ns / NSEC_PER_USEC);
+		data->bus_ns %= NSEC_PER_USEC;
+	}
+}
+
+static int ili9163c_emul_io(const struct emul *target, const struct spi_config *config,
+			    const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs)
+{
+	bool is_cmd = ili9163c_emul_is_cmd(target->cfg);
+	size_t len = 0U;
+
+	if (tx_bufs != NULL) {
+		for (size_t i = 0U; i < tx_bufs->count; i++) {
+			const struct spi_buf *buf = &tx_bufs->buffers[i];
+			const uint8_t *bytes = buf->buf;
+
+			for (size_t j = 0U; (bytes != NULL) && (j < buf->len); j++) {
+				if (is_cmd) {
+					ili9163c_emul_command(target, bytes[j]);
+				} else {
+					ili9163c_emul_data(target, bytes[j]);
+				}
+			}
+
+			len += buf->len;
+		}
+	}
+
+	if (rx_bufs != NULL) {
+		for (size_t i = 0U; i < rx_bufs->count; i++) {
+			const struct spi_buf *buf = &rx_bufs->buffers[i];
+
+			if (buf->buf != NULL) {
+				memset(buf->buf, ili9163c_emul_read(target), buf->len);
+			}
+
+			len += buf->len;
+		}
+	}
+
+	ili9163c_emul_bus_time(target, config, len);
+
+	return 0;
+}
+
+void ili9163c_emul_inject_fault(const struct emul *target, enum ili9163c_emul_fault fault)
+{
+	const struct ili9163c_emul_config *config = target->cfg;
+	struct ili9163c_emul_data *data = target->data;
+
+	switch (fault) {
+	case ILI9163C_EMUL_FAULT_MADCTL:
+		data->madctl ^= ILI9163C_MADCTL_MX | ILI9163C_MADCTL_MY;
+		break;
+	case ILI9163C_EMUL_FAULT_PIXSET:
+		data->pixset ^= ILI9163C_PIXSET_MCU_16_BIT ^ ILI9163C_PIXSET_MCU_18_BIT;
+		break;
+	case ILI9163C_EMUL_FAULT_INVERSION:
+		data->inversion = !data->inversion;
+		break;
+	case ILI9163C_EMUL_FAULT_DISPLAY_OFF:
+		data->display_on = false;
+		break;
+	case ILI9163C_EMUL_FAULT_RESET:
+		memset(config->gram, 0,
+		       (size_t)config->width * config->height * ILI9163C_EMUL_GRAM_BPP);
+		ili9163c_emul_reset(target);
+		break;
+	}
+}
+
+void ili9163c_emul_get_state(const struct emul *target, struct ili9163c_emul_state *state)
+{
+	struct ili9163c_emul_data *data = target->data;
+
+	state->madctl = data->madctl;
+	state->pixset = data->pixset;
+	state->inversion = data->inversion;
+	state->display_on = data->display_on;
+	state->sleep_out = data->sleep_out;
+}
+
+void ili9163c_emul_get_pixel(const struct emul *target, uint16_t x, uint16_t y, uint8_t rgb[3])
+{
+	const struct ili9163c_emul_config *config = target->cfg;
+	const uint8_t *px;
+
+	if ((x >= config->width) || (y >= config->height)) {
+		memset(rgb, 0, 3U);
+		return;
+	}
+
+	px = &config->gram[((size_t)y * config->width + x) * ILI9163C_EMUL_GRAM_BPP];
+	memcpy(rgb, px, 3U);
+}
+
+static int ili9163c_emul_init(const struct emul *target, const struct device *parent)
+{
+	const struct ili9163c_emul_config *config = target->cfg;
+
+	ARG_UNUSED(parent);
+
+	memset(config->gram, 0, (size_t)config->width * config->height * ILI9163C_EMUL_GRAM_BPP);
+	ili9163c_emul_reset(target);
+
+	return 0;
+}
+
+static const struct spi_emul_api ili9163c_emul_api = {
+	.io = ili9163c_emul_io,
+};
+
+#define ILI9163C_EMUL_INIT(n)                                                                      \
+	static uint8_t ili9163c_emul_gram_##n[DT_INST_PROP(n, width) * DT_INST_PROP(n, height) *   \
+					      ILI9163C_EMUL_GRAM_BPP];                             \
+                                                                                                   \
+	static const struct ili9163c_emul_config ili9163c_emul_config_##n = {                      \
+		.dc = GPIO_DT_SPEC_INST_GET(n, dc_gpios),                                          \
+		.width = DT_INST_PROP(n, width),                                                   \
+		.height = DT_INST_PROP(n, height),                                                 \
+		.gram = ili9163c_emul_gram_##n,                                                    \
+	};                                                                                         \
+                                                                                                   \
+	static struct ili9163c_emul_data ili9163c_emul_data_##n;                                   \
+                                                                                                   \
+	EMUL_DT_INST_DEFINE(n, ili9163c_emul_init, &ili9163c_emul_data_##n,                        \
+			    &ili9163c_emul_config_##n, &ili9163c_emul_api, NULL);                  \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, NULL, NULL, NULL, NULL, POST_KERNEL,                              \
+			      CONFIG_DISPLAY_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(ILI9163C_EMUL_INIT);
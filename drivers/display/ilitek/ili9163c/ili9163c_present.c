@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ilitek_ili9163c
+
+#include "ili9163c_priv.h"
+
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(ILI9163C, CONFIG_DISPLAY_LOG_LEVEL);
+
+static K_THREAD_STACK_DEFINE(ili9163c_present_stack, CONFIG_ILI9163C_PRESENT_STACK_SIZE);
+static struct k_work_q ili9163c_present_workq;
+
+static void ili9163c_get_resolution(const struct device *dev, uint16_t *width, uint16_t *height)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	if (data->orientation == DISPLAY_ORIENTATION_NORMAL ||
+	    data->orientation == DISPLAY_ORIENTATION_ROTATED_180) {
+		*width = config->x_resolution;
+		*height = config->y_resolution;
+	} else {
+		*width = config->y_resolution;
+		*height = config->x_resolution;
+	}
+}
+
+static void ili9163c_shadow_copy(const struct device *dev, const uint16_t x, const uint16_t y,
+				 const struct display_buffer_descriptor *desc, const uint8_t *buf)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	size_t bpp = ILI9163C_BYTES_PER_PIXEL(ILI9163C_DEV_DATA(dev));
+	uint16_t width;
+	uint16_t height;
+	uint8_t *dst;
+
+	ili9163c_get_resolution(dev, &width, &height);
+	dst = &config->shadow[((size_t)y * width + x) * bpp];
+
+	for (uint16_t row = 0U; row < desc->height; row++) {
+		memcpy(dst, buf, desc->width * bpp);
+		dst += width * bpp;
+		buf += desc->pitch * bpp;
+	}
+}
+
+/*
+ * Send the changed areas from the shadow framebuffer, with the flush lock held.
+ * The areas are taken under the present lock, which is released during the
+ * transfers so that display writes never wait for the bus. A write made during
+ * a transfer marks its area as changed again, it is sent at the next interval.
+ */
+static int ili9163c_present_flush(const struct device *dev)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	size_t bpp = ILI9163C_BYTES_PER_PIXEL(data);
+	struct display_buffer_descriptor desc;
+	struct ili9163c_area *area;
+	uint64_t sent_pixels = 0U;
+	uint16_t width;
+	uint16_t height;
+	uint8_t count;
+	uint8_t i;
+	int r = 0;
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+	count = data->present_dirty_count;
+	memcpy(data->present_sending, data->present_dirty, count * sizeof(data->present_dirty[0]));
+	data->present_dirty_count = 0U;
+	k_mutex_unlock(&data->present_lock);
+
+	/* The orientation cannot change while presenting. */
+	ili9163c_get_resolution(dev, &width, &height);
+
+	for (i = 0U; i < count; i++) {
+		area = &data->present_sending[i];
+
+		desc.width = area->x1 - area->x0;
+		desc.height = area->y1 - area->y0;
+		desc.pitch = width;
+		desc.buf_size = desc.height * desc.pitch * bpp;
+
+		r = ili9163c_write_direct(dev, area->x0, area->y0, &desc,
+					  &config->shadow[((size_t)area->y0 * width + area->x0) *
+							  bpp]);
+		if (r < 0) {
+			break;
+		}
+
+		sent_pixels += ili9163c_area_size(area);
+	}
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	data->present_stats.sent_pixels += sent_pixels;
+
+	/* Areas not sent are pending again, sent at the next interval. */
+	for (; i < count; i++) {
+		ili9163c_area_add(data->present_dirty, &data->present_dirty_count,
+				  ARRAY_SIZE(data->present_dirty), &data->present_sending[i]);
+	}
+
+	k_mutex_unlock(&data->present_lock);
+
+	return r;
+}
+
+int ili9163c_present_write(const struct device *dev, const uint16_t x, const uint16_t y,
+			   const struct display_buffer_descriptor *desc, const void *buf)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	struct ili9163c_present_stats *stats = &data->present_stats;
+	const struct ili9163c_area area = {x, y, x + desc->width, y + desc->height};
+	uint32_t start = k_cycle_get_32();
+	uint16_t width;
+	uint16_t height;
+	int r = 0;
+
+	ili9163c_get_resolution(dev, &width, &height);
+	if ((area.x1 > width) || (area.y1 > height)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (!data->present_running) {
+		r = -EAGAIN;
+		goto out;
+	}
+
+	ili9163c_shadow_copy(dev, x, y, desc, buf);
+	ili9163c_area_add(data->present_dirty, &data->present_dirty_count,
+			  ARRAY_SIZE(data->present_dirty), &area);
+	stats->writes++;
+	stats->submitted_pixels += desc->width * desc->height;
+	stats->render_cycles += k_cycle_get_32() - start;
+
+out:
+	k_mutex_unlock(&data->present_lock);
+
+	return r;
+}
+
+/* Panel frame rate, from the FRMCTR1 division ratio and porch. */
+static uint16_t ili9163c_panel_frame_rate(const struct device *dev)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	const struct ili9163c_regs *regs = config->regs;
+	uint32_t diva = MAX(regs->frmctr1[0] & ILI9163C_FRMCTR1_DIVA_MASK, 1U);
+	uint32_t vpa = regs->frmctr1[1] & ILI9163C_FRMCTR1_VPA_MASK;
+
+	return ILI9163C_FOSC_HZ / (diva * (ILI9163C_GRAM_ROWS + vpa));
+}
+
+static void ili9163c_present_timer_handler(struct k_timer *timer)
+{
+	struct ili9163c_data *data = CONTAINER_OF(timer, struct ili9163c_data, present_timer);
+
+	data->present_tick = k_cycle_get_32();
+	k_work_submit_to_queue(&ili9163c_present_workq, &data->present_work);
+}
+
+static void ili9163c_present_work_handler(struct k_work *work)
+{
+	struct ili9163c_data *data = CONTAINER_OF(work, struct ili9163c_data, present_work);
+	struct ili9163c_present_stats *stats = &data->present_stats;
+	uint32_t expired = k_timer_status_get(&data->present_timer);
+	uint32_t tick = data->present_tick;
+	uint32_t transfer;
+	uint32_t elapsed;
+	uint32_t slack;
+	uint32_t start;
+	int r;
+
+	k_mutex_lock(&data->present_flush_lock, K_FOREVER);
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (!data->present_running) {
+		goto out;
+	}
+
+	/* Intervals that expired while the previous frame was being sent. */
+	if (expired > 1U) {
+		stats->missed += expired - 1U;
+	}
+
+	if (data->present_dirty_count == 0U) {
+		stats->idle++;
+		goto out;
+	}
+
+	k_mutex_unlock(&data->present_lock);
+
+	start = k_cycle_get_32();
+	r = ili9163c_present_flush(data->dev);
+	if (r < 0) {
+		LOG_ERR("Could not present frame (%d)", r);
+	}
+
+	transfer = k_cycle_get_32() - start;
+	elapsed = k_cycle_get_32() - tick;
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (elapsed > stats->period_cycles) {
+		stats->missed++;
+		slack = 0U;
+	} else {
+		slack = stats->period_cycles - elapsed;
+	}
+
+	stats->frames++;
+	stats->transfer_cycles += transfer;
+	stats->max_transfer_cycles = MAX(stats->max_transfer_cycles, transfer);
+	stats->slack_cycles += slack;
+	stats->min_slack_cycles = MIN(stats->min_slack_cycles, slack);
+
+out:
+	k_mutex_unlock(&data->present_lock);
+	k_mutex_unlock(&data->present_flush_lock);
+}
+
+static void ili9163c_present_reset_stats(struct ili9163c_data *data, uint16_t rate_hz)
+{
+	memset(&data->present_stats, 0, sizeof(data->present_stats));
+	data->present_stats.rate_hz = rate_hz;
+	data->present_stats.period_cycles = k_us_to_cyc_floor32(USEC_PER_SEC / rate_hz);
+	data->present_stats.min_slack_cycles = UINT32_MAX;
+}
+
+int ili9163c_present_start(const struct device *dev, uint16_t rate_hz)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	size_t shadow_bpp = (config->pixel_format == ILI9163C_PIXEL_FORMAT_RGB888) ? 3U : 2U;
+	int r = 0;
+
+	if ((config->shadow == NULL) || (ILI9163C_BYTES_PER_PIXEL(data) > shadow_bpp)) {
+		return -ENOTSUP;
+	}
+
+	if (rate_hz == 0U) {
+		rate_hz = ili9163c_panel_frame_rate(dev);
+	}
+
+	if (rate_hz == 0U) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (data->present_running) {
+		r = -EBUSY;
+		goto out;
+	}
+
+	LOG_DBG("Presenting at %u Hz", rate_hz);
+
+	ili9163c_present_reset_stats(data, rate_hz);
+	data->present_dirty_count = 0U;
+	data->present_running = true;
+
+	k_timer_start(&data->present_timer, K_USEC(USEC_PER_SEC / rate_hz),
+		      K_USEC(USEC_PER_SEC / rate_hz));
+	k_timer_status_get(&data->present_timer);
+
+out:
+	k_mutex_unlock(&data->present_lock);
+
+	return r;
+}
+
+int ili9163c_present_stop(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	bool pending;
+	int r;
+
+	k_mutex_lock(&data->present_flush_lock, K_FOREVER);
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+
+	if (!data->present_running) {
+		k_mutex_unlock(&data->present_lock);
+		k_mutex_unlock(&data->present_flush_lock);
+		return -EALREADY;
+	}
+
+	k_timer_stop(&data->present_timer);
+
+	/* Writes are deferred until the last changes are sent, then sent directly. */
+	do {
+		k_mutex_unlock(&data->present_lock);
+		r = ili9163c_present_flush(dev);
+		k_mutex_lock(&data->present_lock, K_FOREVER);
+
+		pending = (r == 0) && (data->present_dirty_count > 0U);
+	} while (pending);
+
+	data->present_dirty_count = 0U;
+	data->present_running = false;
+
+	k_mutex_unlock(&data->present_lock);
+	k_mutex_unlock(&data->present_flush_lock);
+
+	k_work_cancel(&data->present_work);
+
+	return r;
+}
+
+void ili9163c_get_present_stats(const struct device *dev, struct ili9163c_present_stats *stats)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+	*stats = data->present_stats;
+	k_mutex_unlock(&data->present_lock);
+}
+
+void ili9163c_reset_present_stats(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->present_lock, K_FOREVER);
+	ili9163c_present_reset_stats(data, data->present_stats.rate_hz);
+	k_mutex_unlock(&data->present_lock);
+}
+
+void ili9163c_present_init(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	data->dev = dev;
+	k_mutex_init(&data->present_lock);
+	k_mutex_init(&data->present_flush_lock);
+	k_timer_init(&data->present_timer, ili9163c_present_timer_handler, NULL);
+	k_work_init(&data->present_work, ili9163c_present_work_handler);
+}
+
+static int ili9163c_present_workq_init(void)
+{
+	k_work_queue_init(&ili9163c_present_workq);
+	k_work_queue_start(&ili9163c_present_workq, ili9163c_present_stack,
+			   K_THREAD_STACK_SIZEOF(ili9163c_present_stack),
+			   CONFIG_ILI9163C_PRESENT_PRIORITY, NULL);
+
+	return 0;
+}
+
+SYS_INIT(ili9163c_present_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
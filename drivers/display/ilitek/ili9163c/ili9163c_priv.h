@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Driver state shared by the ILI9163C driver files, which define DT_DRV_COMPAT
+ * before including this header.
+ */
+
+#ifndef ZEPHYR_DRIVERS_DISPLAY_ILI9163C_PRIV_H_
+#define ZEPHYR_DRIVERS_DISPLAY_ILI9163C_PRIV_H_
+
+#include "ili9163c.h"
+
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_ILI9163C_PRESENT
+#include <zephyr/display/ili9163c_area.h>
+#endif
+
+struct ili9163c_data {
+	uint8_t bytes_per_pixel;
+	enum display_pixel_format pixel_format;
+	enum display_orientation orientation;
+	struct k_mutex lock;
+	/* Controller state as programmed by the driver. */
+	uint8_t madctl;
+	uint8_t pixset;
+	bool display_on;
+	bool window_valid;
+	uint16_t window[4];
+#if defined(CONFIG_ILI9163C_RESYNC) || defined(CONFIG_ILI9163C_PRESENT)
+	const struct device *dev;
+#endif
+#ifdef CONFIG_ILI9163C_RESYNC
+	struct k_work_delayable resync_work;
+	struct ili9163c_resync_stats resync_stats;
+	ili9163c_resync_cb_t resync_cb;
+	void *resync_user_data;
+#endif
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	/* Urgent writes waiting for the lock, normal writes yield to them between chunks. */
+	atomic_t urgent_pending;
+	struct k_condvar write_cond;
+	struct ili9163c_write_stats write_stats;
+#endif
+#ifdef CONFIG_ILI9163C_WRITE_HOOK
+	ili9163c_write_hook_t write_hook;
+	void *write_hook_user_data;
+#endif
+#ifdef CONFIG_ILI9163C_PRESENT
+	/* Protects the shadow framebuffer, the changed areas and the present statistics. */
+	struct k_mutex present_lock;
+	bool present_running;
+	struct ili9163c_area present_dirty[CONFIG_ILI9163C_PRESENT_DIRTY_RECTS];
+	uint8_t present_dirty_count;
+	/* Serializes frames, taken before the present lock and released during transfers. */
+	struct k_mutex present_flush_lock;
+	struct ili9163c_area present_sending[CONFIG_ILI9163C_PRESENT_DIRTY_RECTS];
+	struct k_timer present_timer;
+	struct k_work present_work;
+	/* Cycle count at the start of the current frame interval. */
+	uint32_t present_tick;
+	struct ili9163c_present_stats present_stats;
+#endif
+#ifdef CONFIG_ILI9163C_RECORD
+	/* Protects the recording state, taken after the driver lock. */
+	struct k_mutex record_lock;
+	ili9163c_record_sink_t record_sink;
+	void *record_user_data;
+	/* Cycle count of the previous record. */
+	uint32_t record_cycles;
+	size_t record_len;
+	uint8_t record_buf[CONFIG_ILI9163C_RECORD_BUFFER_SIZE];
+	struct ili9163c_record_stats record_stats;
+#endif
+#ifdef CONFIG_ILI9163C_RGB444
+	bool rgb444;
+	/* Pixel of the RAMWR stream in progress waiting for the next one to fill 3 bytes. */
+	bool rgb444_odd;
+	uint16_t rgb444_pending;
+#endif
+};
+
+#ifdef CONFIG_ILI9163C_FIXED_CONFIG
+/*
+ * The only instance is known at build time: its config, data, pixel format and
+ * rotation are constants, so unused formats and rotations are compiled out.
+ * Its config and data are referenced by name from every driver file.
+ */
+#define ILI9163C_INST_STORAGE
+extern const struct ili9163c_config ili9163c_config_0;
+extern struct ili9163c_data ili9163c_data_0;
+
+#define ILI9163C_DEV_CONFIG(dev)       (&ili9163c_config_0)
+#define ILI9163C_DEV_DATA(dev)         (&ili9163c_data_0)
+#define ILI9163C_HAS_ROTATION(deg)     (DT_INST_PROP(0, rotation) == (deg))
+/* RGB444 panels take RGB565 pixels. */
+#define ILI9163C_FIXED_PIXEL_FORMAT                                                                \
+	((DT_INST_PROP(0, pixel_format) == ILI9163C_PIXEL_FORMAT_RGB888)                           \
+		 ? ILI9163C_PIXEL_FORMAT_RGB888                                                    \
+		 : ILI9163C_PIXEL_FORMAT_RGB565)
+#define ILI9163C_HAS_PIXEL_FORMAT(fmt) (ILI9163C_FIXED_PIXEL_FORMAT == ILI9163C_PIXEL_FORMAT_##fmt)
+#define ILI9163C_BYTES_PER_PIXEL(data) (ILI9163C_HAS_PIXEL_FORMAT(RGB565) ? 2U : 3U)
+#define ILI9163C_CURRENT_PIXEL_FORMAT(data)                                                        \
+	(ILI9163C_HAS_PIXEL_FORMAT(RGB565) ? PIXEL_FORMAT_RGB_565 : PIXEL_FORMAT_RGB_888)
+#else
+#define ILI9163C_INST_STORAGE               static
+#define ILI9163C_DEV_CONFIG(dev)            ((const struct ili9163c_config *)(dev)->config)
+#define ILI9163C_DEV_DATA(dev)              ((struct ili9163c_data *)(dev)->data)
+#define ILI9163C_HAS_ROTATION(deg)          1
+#define ILI9163C_HAS_PIXEL_FORMAT(fmt)      1
+#define ILI9163C_BYTES_PER_PIXEL(data)      ((data)->bytes_per_pixel)
+#define ILI9163C_CURRENT_PIXEL_FORMAT(data) ((data)->pixel_format)
+#endif
+
+#if !defined(CONFIG_ILI9163C_RGB444)
+#define ILI9163C_IS_RGB444(data) false
+#elif defined(CONFIG_ILI9163C_FIXED_CONFIG)
+#define ILI9163C_IS_RGB444(data) (DT_INST_PROP(0, pixel_format) == ILI9163C_PIXEL_FORMAT_RGB444)
+#else
+#define ILI9163C_IS_RGB444(data) ((data)->rgb444)
+#endif
+
+/* Send a write to the panel, bypassing the present scheduler. */
+int ili9163c_write_direct(const struct device *dev, const uint16_t x, const uint16_t y,
+			  const struct display_buffer_descriptor *desc, const void *buf);
+
+#ifdef CONFIG_ILI9163C_PRESENT
+void ili9163c_present_init(const struct device *dev);
+
+/* Defer a write to the next frame interval, -EAGAIN when not presenting. */
+int ili9163c_present_write(const struct device *dev, const uint16_t x, const uint16_t y,
+			   const struct display_buffer_descriptor *desc, const void *buf);
+#endif
+
+#ifdef CONFIG_ILI9163C_RECORD
+/* Record a transaction, payload is NULL for reads and resets. */
+void ili9163c_record(const struct device *dev, uint8_t type, uint8_t arg, const void *payload,
+		     size_t len);
+#endif
+
+#endif /* ZEPHYR_DRIVERS_DISPLAY_ILI9163C_PRIV_H_ */
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ilitek_ili9163c
+
+#include "ili9163c_priv.h"
+
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_FILE_SYSTEM
+#include <zephyr/fs/fs.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(ILI9163C, CONFIG_DISPLAY_LOG_LEVEL);
+
+static void ili9163c_record_send(struct ili9163c_data *data, const uint8_t *bytes, size_t len)
+{
+	int r;
+
+	if (data->record_stats.error != 0) {
+		return;
+	}
+
+	r = data->record_sink(bytes, len, data->record_user_data);
+	if (r < 0) {
+		LOG_ERR("Recording sink failed (%d), recording stopped", r);
+		data->record_stats.error = r;
+		return;
+	}
+
+	data->record_stats.stream_bytes += len;
+}
+
+static void ili9163c_record_flush(struct ili9163c_data *data)
+{
+	if (data->record_len > 0U) {
+		ili9163c_record_send(data, data->record_buf, data->record_len);
+		data->record_len = 0U;
+	}
+}
+
+static void ili9163c_record_put(struct ili9163c_data *data, const void *bytes, size_t len)
+{
+	if (data->record_len + len > sizeof(data->record_buf)) {
+		ili9163c_record_flush(data);
+	}
+
+	/* Large payloads bypass the buffer. */
+	if (len > sizeof(data->record_buf)) {
+		ili9163c_record_send(data, bytes, len);
+		return;
+	}
+
+	memcpy(&data->record_buf[data->record_len], bytes, len);
+	data->record_len += len;
+}
+
+static void ili9163c_record_put_varint(struct ili9163c_data *data, uint32_t value)
+{
+	uint8_t bytes[5];
+	size_t len = 0U;
+
+	do {
+		bytes[len] = value & 0x7FU;
+		value >>= 7;
+		if (value != 0U) {
+			bytes[len] |= 0x80U;
+		}
+		len++;
+	} while (value != 0U);
+
+	ili9163c_record_put(data, bytes, len);
+}
+
+void ili9163c_record(const struct device *dev, uint8_t type, uint8_t arg, const void *payload,
+		     size_t len)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	struct ili9163c_record_stats *stats = &data->record_stats;
+	uint32_t now = k_cycle_get_32();
+
+	if (data->record_sink == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&data->record_lock, K_FOREVER);
+
+	if ((data->record_sink == NULL) || (stats->error != 0)) {
+		goto out;
+	}
+
+	ili9163c_record_put(data, &type, 1U);
+	ili9163c_record_put_varint(data, now - data->record_cycles);
+	ili9163c_record_put(data, &arg, 1U);
+	data->record_cycles = now;
+
+	if (type != ILI9163C_RECORD_RESET) {
+		ili9163c_record_put_varint(data, len);
+	}
+
+	if (payload != NULL) {
+		ili9163c_record_put(data, payload, len);
+	}
+
+	switch (type) {
+	case ILI9163C_RECORD_COMMAND:
+		stats->commands++;
+		stats->command_bytes += 1U + len;
+		break;
+	case ILI9163C_RECORD_DATA:
+		stats->writes++;
+		stats->data_bytes += len;
+		break;
+	case ILI9163C_RECORD_READ:
+		stats->reads++;
+		stats->command_bytes++;
+		break;
+	default:
+		break;
+	}
+
+out:
+	k_mutex_unlock(&data->record_lock);
+}
+
+int ili9163c_record_start(const struct device *dev, ili9163c_record_sink_t sink, void *user_data)
+{
+	const struct ili9163c_config *config = ILI9163C_DEV_CONFIG(dev);
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+	uint8_t header[16];
+
+	int r = 0;
+
+	/* The driver lock keeps the recorded controller state until the first record. */
+	k_mutex_lock(&data->lock, K_FOREVER);
+	k_mutex_lock(&data->record_lock, K_FOREVER);
+
+	if (data->record_sink != NULL) {
+		r = -EBUSY;
+		goto out;
+	}
+
+	header[0] = ILI9163C_RECORD_HEADER;
+	header[1] = ILI9163C_RECORD_VERSION;
+	sys_put_le16(config->x_resolution, &header[2]);
+	sys_put_le16(config->y_resolution, &header[4]);
+	header[6] = data->madctl;
+	header[7] = data->pixset;
+	sys_put_le32(config->dbi_config.config.frequency, &header[8]);
+	sys_put_le32(sys_clock_hw_cycles_per_sec(), &header[12]);
+
+	memset(&data->record_stats, 0, sizeof(data->record_stats));
+	data->record_sink = sink;
+	data->record_user_data = user_data;
+	data->record_len = 0U;
+	data->record_cycles = k_cycle_get_32();
+
+	ili9163c_record_send(data, header, sizeof(header));
+
+	r = data->record_stats.error;
+	if (r < 0) {
+		data->record_sink = NULL;
+	}
+
+out:
+	k_mutex_unlock(&data->record_lock);
+	k_mutex_unlock(&data->lock);
+
+	return r;
+}
+
+int ili9163c_record_stop(const struct device *dev)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	int r;
+
+	k_mutex_lock(&data->record_lock, K_FOREVER);
+
+	if (data->record_sink == NULL) {
+		r = -EALREADY;
+	} else {
+		ili9163c_record_flush(data);
+		r = data->record_stats.error;
+		data->record_sink = NULL;
+	}
+
+	k_mutex_unlock(&data->record_lock);
+
+	return r;
+}
+
+void ili9163c_get_record_stats(const struct device *dev, struct ili9163c_record_stats *stats)
+{
+	struct ili9163c_data *data = ILI9163C_DEV_DATA(dev);
+
+	k_mutex_lock(&data->record_lock, K_FOREVER);
+	*stats = data->record_stats;
+	k_mutex_unlock(&data->record_lock);
+}
+
+int ili9163c_record_console_sink(const uint8_t *data, size_t len, void *user_data)
+{
+	char line[2U * 32U + 1U];
+	size_t n;
+
+	ARG_UNUSED(user_data);
+
+	for (size_t i = 0U; i < len; i += n) {
+		n = MIN(len - i, 32U);
+		bin2hex(&data[i], n, line, sizeof(line));
+		printk(ILI9163C_RECORD_CONSOLE_PREFIX "%s\n", line);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_FILE_SYSTEM
+int ili9163c_record_fs_sink(const uint8_t *data, size_t len, void *user_data)
+{
+	struct fs_file_t *file = user_data;
+	ssize_t r;
+
+	r = fs_write(file, data, len);
+	if (r < 0) {
+		return (int)r;
+	}
+
+	return ((size_t)r == len) ? 0 : -ENOSPC;
+}
+#endif
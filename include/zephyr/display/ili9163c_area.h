@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_AREA_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_AREA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Area of the screen, end coordinates excluded. */
+struct ili9163c_area {
+	uint16_t x0;
+	uint16_t y0;
+	uint16_t x1;
+	uint16_t y1;
+};
+
+/**
+ * @brief Get the number of pixels of an area.
+ *
+ * @param area Area.
+ */
+static inline uint32_t ili9163c_area_size(const struct ili9163c_area *area)
+{
+	return (uint32_t)(area->x1 - area->x0) * (area->y1 - area->y0);
+}
+
+/**
+ * @brief Extend an area to the bounding box of itself and another area.
+ *
+ * @param area Area to extend.
+ * @param other Other area.
+ */
+static inline void ili9163c_area_union(struct ili9163c_area *area,
+				       const struct ili9163c_area *other)
+{
+	area->x0 = MIN(area->x0, other->x0);
+	area->y0 = MIN(area->y0, other->y0);
+	area->x1 = MAX(area->x1, other->x1);
+	area->y1 = MAX(area->y1, other->y1);
+}
+
+/**
+ * @brief Add an area to a list of pending changed areas.
+ *
+ * The area is merged with the pending area it wastes the fewest pixels with,
+ * pixels covered by the merged area but by neither of the two. It is added
+ * as a new entry when every merge wastes pixels and the list is not full.
+ * Empty areas are ignored.
+ *
+ * @param list Pending areas.
+ * @param count Number of pending areas, updated.
+ * @param max Capacity of @p list, at least 1.
+ * @param area Changed area.
+ *
+ * @retval true if the area was merged into a pending area.
+ * @retval false if it was added or ignored.
+ */
+bool ili9163c_area_add(struct ili9163c_area *list, uint8_t *count, uint8_t max,
+		       const struct ili9163c_area *area);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_AREA_H_ */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_BANDS_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_BANDS_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Band rendering callback.
+ *
+ * Called from the worker threads, possibly concurrently on several CPUs for
+ * different bands of the same frame.
+ *
+ * @param buf Band buffer to fill, in the current pixel format of the display.
+ * @param desc Size of the band: full display width, @p desc->height rows.
+ * @param y First row of the band on the display.
+ * @param frame Frame number given to ili9163c_bands_frame().
+ * @param user_data User data given in the configuration.
+ */
+typedef void (*ili9163c_bands_render_t)(uint8_t *buf, const struct display_buffer_descriptor *desc,
+					uint16_t y, uint32_t frame, void *user_data);
+
+/** Pipeline parameters. */
+struct ili9163c_bands_config {
+	/** Display device. */
+	const struct device *display;
+	/** Band rendering callback. */
+	ili9163c_bands_render_t render;
+	/** User data passed to the callback. */
+	void *user_data;
+	/** Worker threads, at most CONFIG_ILI9163C_BANDS_MAX_WORKERS, 0 for one per CPU. */
+	uint8_t workers;
+};
+
+/** Pipeline statistics. Durations are in hardware cycles. */
+struct ili9163c_bands_stats {
+	/** Frames written. */
+	uint32_t frames;
+	/** Rows per band. */
+	uint16_t band_rows;
+	/** Total frame time. */
+	uint64_t frame_cycles;
+	/** Longest frame time. */
+	uint32_t max_frame_cycles;
+	/** Time the writer waited for bands to be rendered. */
+	uint64_t stall_cycles;
+};
+
+/**
+ * @brief Start the rendering pipeline.
+ *
+ * Frames are split into horizontal bands of as many full rows as a
+ * CONFIG_ILI9163C_BANDS_BUFFER_SIZE buffer holds. Worker threads, pinned one
+ * per CPU when CONFIG_SCHED_CPU_MASK is enabled, render bands into a ring of
+ * CONFIG_ILI9163C_BANDS_BUFFERS buffers while the calling thread of
+ * ili9163c_bands_frame() writes the rendered bands in order, so rendering and
+ * transmission overlap.
+ *
+ * @param config Pipeline parameters.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if the pipeline is already running.
+ * @retval -EINVAL if the parameters are invalid or a row does not fit in a buffer.
+ */
+int ili9163c_bands_start(const struct ili9163c_bands_config *config);
+
+/**
+ * @brief Render and write a frame.
+ *
+ * Blocks until the last band of the frame is written.
+ *
+ * @param frame Frame number passed to the rendering callback.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if the pipeline is not running.
+ * @retval -errno Negative errno code of the first failed display write.
+ */
+int ili9163c_bands_frame(uint32_t frame);
+
+/**
+ * @brief Stop the rendering pipeline and its worker threads.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if the pipeline is not running.
+ */
+int ili9163c_bands_stop(void);
+
+/**
+ * @brief Get the pipeline statistics since the last start.
+ *
+ * @param stats Statistics output.
+ */
+void ili9163c_bands_get_stats(struct ili9163c_bands_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_BANDS_H_ */
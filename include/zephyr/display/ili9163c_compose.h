@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_COMPOSE_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_COMPOSE_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Layer, or sprite, drawn over the background. */
+struct ili9163c_layer {
+	/**
+	 * Pixels in the current pixel format of the display, with the byte order
+	 * the display expects (RGB565 big endian or RGB888). May be in flash.
+	 */
+	const uint8_t *pixels;
+	/** Pixels per row of @p pixels, 0 for @p width. */
+	uint16_t pitch;
+	/** Position of the top left corner, may be partially or fully off screen. */
+	int16_t x;
+	int16_t y;
+	/** Size, in pixels. */
+	uint16_t width;
+	uint16_t height;
+	/** Transparent color, as an RGB565 value or 0xRRGGBB, used when @p keyed is set. */
+	uint32_t key;
+	/** Pixels of the @p key color are not drawn. */
+	bool keyed;
+	/** The layer is drawn. */
+	bool visible;
+};
+
+/** Compositor parameters. */
+struct ili9163c_compose_config {
+	/** Display device. */
+	const struct device *display;
+	/**
+	 * Full screen background, in the same format as the layer pixels, or NULL
+	 * for a solid color. May be in flash.
+	 */
+	const uint8_t *background;
+	/** Background color, as 0xRRGGBB, when @p background is NULL. */
+	uint32_t background_color;
+	/** Layers, from bottom to top. */
+	const struct ili9163c_layer *layers;
+	/** Number of layers, at most CONFIG_ILI9163C_COMPOSE_MAX_LAYERS. */
+	uint8_t layer_count;
+};
+
+/** Compositor statistics. */
+struct ili9163c_compose_stats {
+	/** Calls to ili9163c_compose_update(). */
+	uint32_t updates;
+	/** Areas composed and written. */
+	uint32_t areas;
+	/** Display writes. */
+	uint32_t writes;
+	/** Pixels written. */
+	uint64_t pixels;
+};
+
+/**
+ * @brief Start composing the screen.
+ *
+ * The layers are kept by reference: the application moves them, shows or
+ * hides them and changes their pixels pointer, then calls
+ * ili9163c_compose_update(). The whole screen is written by the next update.
+ *
+ * @param config Compositor parameters.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the parameters are invalid or a display row does not fit
+ * in the CONFIG_ILI9163C_COMPOSE_BUFFER_SIZE line buffer.
+ * @retval -ENOTSUP if the pixel format of the display is not supported.
+ */
+int ili9163c_compose_init(const struct ili9163c_compose_config *config);
+
+/**
+ * @brief Write the areas of the screen changed since the last update.
+ *
+ * A layer has changed when its pixels pointer, position, size or visibility
+ * differs from the last update; its previous and new areas are then
+ * composed again. Areas are composed from the background and the layers a few
+ * rows at a time into the line buffer, each band being written with
+ * display_write(), so that no framebuffer is needed.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the compositor is not initialized.
+ * @retval -errno Negative errno code of the first failed display write. The
+ * whole screen is written again by the next update.
+ */
+int ili9163c_compose_update(void);
+
+/**
+ * @brief Mark an area to be composed again by the next update.
+ *
+ * Needed when the pixels of a layer or of the background are modified in
+ * place.
+ *
+ * @param x Column of the left of the area.
+ * @param y Row of the top of the area.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ */
+void ili9163c_compose_invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/**
+ * @brief Get the compositor statistics since the last initialization.
+ *
+ * @param stats Statistics output.
+ */
+void ili9163c_compose_get_stats(struct ili9163c_compose_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_COMPOSE_H_ */
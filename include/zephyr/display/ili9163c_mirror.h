@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_MIRROR_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_MIRROR_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Mirror stream format.
+ *
+ * The stream is a sequence of records, each starting with
+ * ILI9163C_MIRROR_SYNC and a record type. Multi-byte fields are little endian.
+ *
+ * - ILI9163C_MIRROR_HEADER: version (u8), pixel format (u8, 0 for RGB565),
+ *   width (u16), height (u16). Sent first, and again after snapshots and sink
+ *   errors. The decoder image is cleared.
+ * - ILI9163C_MIRROR_RECT: x, y, width, height (u16), then the pixels of the
+ *   rectangle, row by row. Each row is a sequence of packets: a count byte n
+ *   followed by either one RGB565 pixel repeated (n & 0x7F) + 1 times when
+ *   bit 7 is set, or n + 1 RGB565 pixels otherwise. Packets do not span rows.
+ * - ILI9163C_MIRROR_FRAME: sequence number (u32), uptime in ms (u32). Ends an
+ *   update: the decoder image matches the display.
+ *
+ * scripts/ili9163c_mirror.py decodes the stream to PPM or PNG images.
+ * @{
+ */
+#define ILI9163C_MIRROR_SYNC    0xA5
+#define ILI9163C_MIRROR_HEADER  'H'
+#define ILI9163C_MIRROR_RECT    'R'
+#define ILI9163C_MIRROR_FRAME   'F'
+#define ILI9163C_MIRROR_VERSION 1
+/** @} */
+
+/**
+ * @brief Stream sink.
+ *
+ * Called from the mirror thread, it may block.
+ *
+ * @param data Stream bytes.
+ * @param len Number of bytes.
+ * @param user_data User data given to ili9163c_mirror_start().
+ *
+ * @retval 0 on success.
+ * @retval -errno Negative errno code on failure, the next update then resends
+ *         the whole screen.
+ */
+typedef int (*ili9163c_mirror_sink_t)(const uint8_t *data, size_t len, void *user_data);
+
+/** Mirroring statistics. */
+struct ili9163c_mirror_stats {
+	/** Display writes observed. */
+	uint32_t writes;
+	/** Display writes that changed at least one pixel. */
+	uint32_t changed;
+	/** Updates sent, each ending with a frame record. */
+	uint32_t updates;
+	/** Rectangles sent. */
+	uint32_t rects;
+	/** Changed areas merged into pending rectangles before being sent. */
+	uint32_t coalesced;
+	/** Sink failures. */
+	uint32_t sink_errors;
+	/** Bytes sent to the sink. */
+	uint64_t bytes;
+	/** Bytes the sent rectangles take as raw RGB565. */
+	uint64_t raw_bytes;
+	/** Longest time spent in the display write path, in hardware cycles. */
+	uint32_t max_hook_cycles;
+};
+
+/**
+ * @brief Start mirroring a display.
+ *
+ * Every write to the display is compared with a shadow copy of the screen,
+ * and the changed area is queued. A low priority thread sends the queued
+ * areas to @p sink as RLE compressed rectangles. The display write path never
+ * waits for the sink: while the sink is busy, new changes are merged into the
+ * queued areas, so the stream skips intermediate frames instead of growing.
+ *
+ * Only pixels written after the start are known, the rest of the screen is
+ * mirrored as black. Pixels are mirrored in RGB565.
+ *
+ * The screen shape is checked on every write. After display_set_orientation()
+ * swaps the resolutions, the shadow is cleared and a new header is sent, so
+ * the screen is mirrored as black again until it is redrawn.
+ *
+ * @param dev ILI9163C display device.
+ * @param sink Stream sink.
+ * @param user_data User data passed to the sink.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if mirroring is already running.
+ * @retval -ENOMEM if the screen does not fit in CONFIG_ILI9163C_MIRROR_MAX_PIXELS
+ *         or a row does not fit in CONFIG_ILI9163C_MIRROR_BUFFER_SIZE.
+ */
+int ili9163c_mirror_start(const struct device *dev, ili9163c_mirror_sink_t sink, void *user_data);
+
+/**
+ * @brief Stop mirroring.
+ *
+ * Sends the pending changes and waits for the mirror thread to exit.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if mirroring is not running.
+ */
+int ili9163c_mirror_stop(void);
+
+/**
+ * @brief Send the whole screen with the next update.
+ */
+void ili9163c_mirror_snapshot(void);
+
+/**
+ * @brief Get the mirroring statistics.
+ *
+ * @param stats Statistics output.
+ */
+void ili9163c_mirror_get_stats(struct ili9163c_mirror_stats *stats);
+
+#ifdef CONFIG_SERIAL
+/**
+ * @brief Sink writing the stream to a UART.
+ *
+ * @p user_data is the UART device.
+ */
+int ili9163c_mirror_uart_sink(const uint8_t *data, size_t len, void *user_data);
+#endif
+
+#ifdef CONFIG_FILE_SYSTEM
+/**
+ * @brief Sink writing the stream to a file.
+ *
+ * @p user_data is the opened struct fs_file_t.
+ */
+int ili9163c_mirror_fs_sink(const uint8_t *data, size_t len, void *user_data);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_MIRROR_H_ */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_PLAYER_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_PLAYER_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Playback parameters. */
+struct ili9163c_player_config {
+	/** Display device. */
+	const struct device *display;
+	/** Path of the file holding the frames. */
+	const char *path;
+	/** Position of the frames on the display. */
+	uint16_t x;
+	uint16_t y;
+	/** Size of the frames, in pixels. */
+	uint16_t width;
+	uint16_t height;
+	/** Target frame rate. */
+	uint16_t fps;
+	/** Number of frames to show, 0 to stop at the end of the file. */
+	uint32_t max_frames;
+	/** Restart from the first frame at the end of the file. */
+	bool loop;
+};
+
+/** Playback statistics. */
+struct ili9163c_player_stats {
+	/** Frames written to the display. */
+	uint32_t frames;
+	/** Frames skipped because they could no longer be shown in time. */
+	uint32_t dropped;
+	/** Frames shown later than one frame period after their deadline. */
+	uint32_t late;
+	/** Times the display writer waited for the reader. */
+	uint32_t underruns;
+	/** Time spent reading the file, in microseconds. */
+	uint64_t read_us;
+	/** Time spent writing to the display, in microseconds. */
+	uint64_t write_us;
+};
+
+/**
+ * @brief Play frames from a file.
+ *
+ * The file holds raw frames of @p width x @p height pixels, one after the
+ * other, in the current pixel format of the display with the byte order the
+ * display expects (RGB565 big endian or RGB888). Frames are read ahead by a
+ * reader thread while previously read rows are written to the display, and
+ * shown at the target frame rate. When the reader falls behind by more than
+ * one frame, frames are skipped instead of being read.
+ *
+ * Blocks until playback ends or ili9163c_player_stop() is called. Only one
+ * playback can run at a time.
+ *
+ * @param config Playback parameters.
+ * @param stats Playback statistics output, may be NULL.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if a playback is already running.
+ * @retval -EINVAL if the parameters or the file size are invalid.
+ * @retval -errno Negative errno code on file or display failure.
+ */
+int ili9163c_player_play(const struct ili9163c_player_config *config,
+			 struct ili9163c_player_stats *stats);
+
+/**
+ * @brief Stop the running playback.
+ *
+ * ili9163c_player_play() returns after the frame being written.
+ */
+void ili9163c_player_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_PLAYER_H_ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_ILI9163C_TEXT_H_
+#define ZEPHYR_INCLUDE_DISPLAY_ILI9163C_TEXT_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Monospaced font.
+ *
+ * Glyphs are stored from @p first to @p last, each as @p height rows of
+ * DIV_ROUND_UP(width * bpp, 8) bytes. Pixels are packed most significant bits
+ * first and hold the glyph coverage: 0 for the background, 1 (1 bpp) or 15
+ * (4 bpp) for the foreground. scripts/ili9163c_font.py generates fonts from
+ * TrueType files.
+ */
+struct ili9163c_font {
+	/** Glyph bitmaps. */
+	const uint8_t *glyphs;
+	/** Glyph size, in pixels. */
+	uint8_t width;
+	uint8_t height;
+	/** Bits per pixel: 1, or 4 for anti-aliased fonts. */
+	uint8_t bpp;
+	/** First and last character of the font. */
+	uint8_t first;
+	uint8_t last;
+};
+
+/** DejaVu Sans Mono, 8x16 pixels, 1 bpp. */
+extern const struct ili9163c_font ili9163c_font_mono_8x16;
+/** DejaVu Sans Mono, 8x16 pixels, 4 bpp anti-aliased. */
+extern const struct ili9163c_font ili9163c_font_mono_8x16_aa;
+
+/** Text style. */
+struct ili9163c_text_style {
+	/** Font. */
+	const struct ili9163c_font *font;
+	/** Foreground and background colors, as 0xRRGGBB. */
+	uint32_t fg;
+	uint32_t bg;
+};
+
+/** Text rendering statistics. */
+struct ili9163c_text_stats {
+	/** Characters drawn. */
+	uint32_t chars;
+	/** Glyphs found already expanded in the cache. */
+	uint32_t hits;
+	/** Glyphs expanded into the cache. */
+	uint32_t misses;
+	/** Cache flushes caused by a change of font, colors or pixel format. */
+	uint32_t flushes;
+	/** Display writes. */
+	uint32_t writes;
+};
+
+/**
+ * @brief Draw a line of text.
+ *
+ * Glyphs are expanded once into a cache, in the colors of @p style and the
+ * current pixel format of the display, then copied side by side into a line
+ * buffer which is written with a single display_write() call, or one per
+ * CONFIG_ILI9163C_TEXT_BUFFER_SIZE bytes for long lines. Characters missing
+ * from the font are drawn as '?', or as the first character of the font.
+ * The text is clipped to the display.
+ *
+ * @param dev Display device.
+ * @param style Text style.
+ * @param x Column of the left of the text.
+ * @param y Row of the top of the text.
+ * @param text Null terminated text, on a single line.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the font is invalid or too large for the line buffer.
+ * @retval -ENOTSUP if the pixel format of the display is not supported.
+ * @retval -errno Negative errno code on display failure.
+ */
+int ili9163c_text_draw(const struct device *dev, const struct ili9163c_text_style *style,
+		       uint16_t x, uint16_t y, const char *text);
+
+/**
+ * @brief Get the text rendering statistics.
+ *
+ * @param stats Statistics output.
+ */
+void ili9163c_text_get_stats(struct ili9163c_text_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_ILI9163C_TEXT_H_ */
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Controller state that diverged from the driver cache.
+ * @{
+ */
+/** Controller was reset: all registers were replayed and GRAM content is lost. */
+#define ILI9163C_RESYNC_RESET     BIT(0)
+/** Memory access control (MADCTL) was replayed. */
+#define ILI9163C_RESYNC_MADCTL    BIT(1)
+/** Pixel format (PIXSET) was replayed. */
+#define ILI9163C_RESYNC_PIXSET    BIT(2)
+/** Display inversion was replayed. */
+#define ILI9163C_RESYNC_INVERSION BIT(3)
+/** Display on/off was replayed. */
+#define ILI9163C_RESYNC_DISPLAY   BIT(4)
+/** @} */
+
+/** Resynchronization statistics. Durations are in hardware cycles. */
+struct ili9163c_resync_stats {
+	/** Number of status checks performed. */
+	uint32_t checks;
+	/** Number of checks that found diverged state. */
+	uint32_t recoveries;
+	/** ILI9163C_RESYNC_* flags of the last recovery. */
+	uint32_t last_diverged;
+	/** Duration of the last status check, recovery excluded. */
+	uint32_t check_cycles;
+	/** Duration of the last recovery. */
+	uint32_t recovery_cycles;
+	/** Longest recovery. */
+	uint32_t max_recovery_cycles;
+};
+
+/**
+ * @brief Callback invoked after diverged state was replayed.
+ *
+ * @param dev ILI9163C display device.
+ * @param diverged ILI9163C_RESYNC_* flags of the replayed state. When
+ *        ILI9163C_RESYNC_RESET is set, the application must redraw.
+ * @param user_data User data given at registration.
+ */
+typedef void (*ili9163c_resync_cb_t)(const struct device *dev, uint32_t diverged,
+				     void *user_data);
+
+/**
+ * @brief Check the controller state and replay what diverged.
+ *
+ * Reads the power mode (RDDPM), MADCTL, pixel format and image mode back from
+ * the controller and compares them with the state programmed by the driver.
+ * RDDPM is used rather than the 4-byte RDDST, as it holds the sleep and
+ * display on bits in a single byte read. Only the diverged registers are
+ * written again. If the controller was reset, the whole configuration,
+ * including the RGBSET color lookup table with CONFIG_ILI9163C_READ, is
+ * replayed and sleep mode is exited, without hardware reset.
+ *
+ * This is also done periodically when CONFIG_ILI9163C_RESYNC_PERIOD_MS is not 0.
+ *
+ * @param dev ILI9163C display device.
+ *
+ * @retval ILI9163C_RESYNC_* flags of the replayed state, 0 if none diverged.
+ * @retval -ENOTSUP if the MIPI-DBI bus is write-only.
+ * @retval -errno Negative errno code on other failure.
+ */
+int ili9163c_resync(const struct device *dev);
+
+/**
+ * @brief Set the callback invoked after diverged state was replayed.
+ *
+ * @param dev ILI9163C display device.
+ * @param cb Callback, NULL to disable.
+ * @param user_data User data passed to the callback.
+ */
+void ili9163c_set_resync_callback(const struct device *dev, ili9163c_resync_cb_t cb,
+				  void *user_data);
+
+/**
+ * @brief Get the resynchronization statistics.
+ *
+ * @param dev ILI9163C display device.
+ * @param stats Statistics output.
+ */
+void ili9163c_get_resync_stats(const struct device *dev, struct ili9163c_resync_stats *stats);
+
+/** Write priorities. */
+enum ili9163c_write_priority {
+	/** Writes larger than CONFIG_ILI9163C_WRITE_URGENT_PIXELS, sent in chunks. */
+	ILI9163C_WRITE_PRIORITY_NORMAL,
+	/** Small writes, sent between the chunks of a normal write in progress. */
+	ILI9163C_WRITE_PRIORITY_URGENT,
+	ILI9163C_WRITE_PRIORITY_COUNT,
+};
+
+/** Latency of the writes of one priority, from the call to the end of the transfer. */
+struct ili9163c_write_latency {
+	/** Number of writes. */
+	uint32_t count;
+	/** Longest latency, in hardware cycles. */
+	uint32_t max_cycles;
+	/** Sum of the latencies, in hardware cycles. */
+	uint64_t total_cycles;
+};
+
+/** Write scheduling statistics. */
+struct ili9163c_write_stats {
+	/** Latency per ili9163c_write_priority. */
+	struct ili9163c_write_latency latency[ILI9163C_WRITE_PRIORITY_COUNT];
+	/** Chunks sent. */
+	uint32_t chunks;
+	/** Normal writes interrupted to let urgent writes through. */
+	uint32_t preemptions;
+};
+
+/**
+ * @brief Get the write scheduling statistics.
+ *
+ * Requires CONFIG_ILI9163C_PREEMPTIBLE_WRITE.
+ *
+ * @param dev ILI9163C display device.
+ * @param stats Statistics output.
+ */
+void ili9163c_get_write_stats(const struct device *dev, struct ili9163c_write_stats *stats);
+
+/**
+ * @brief Reset the write scheduling statistics.
+ *
+ * Requires CONFIG_ILI9163C_PREEMPTIBLE_WRITE.
+ *
+ * @param dev ILI9163C display device.
+ */
+void ili9163c_reset_write_stats(const struct device *dev);
+
+/** Bounce buffer pool statistics. */
+struct ili9163c_buf_stats {
+	/** Size of each buffer, in bytes. */
+	uint32_t size;
+	/** Number of buffers. */
+	uint32_t count;
+	/** Buffers currently in use. */
+	uint32_t in_use;
+	/** Most buffers in use at the same time. */
+	uint32_t high_watermark;
+	/** Acquisitions that failed, the pool being empty or the size too large. */
+	uint32_t failures;
+};
+
+/**
+ * @brief Acquire a bounce buffer from the driver pool.
+ *
+ * The pool holds CONFIG_ILI9163C_BUF_COUNT static buffers of
+ * CONFIG_ILI9163C_BUF_SIZE bytes, aligned on CONFIG_ILI9163C_BUF_ALIGN bytes
+ * for DMA. It is shared by all ILI9163C instances and never uses the heap.
+ * Acquisition and release are lock-free and never block, so they can be used
+ * from the write path and from interrupts.
+ *
+ * Requires CONFIG_ILI9163C_BUF_POOL.
+ *
+ * @param size Required size, in bytes.
+ *
+ * @return Buffer of CONFIG_ILI9163C_BUF_SIZE bytes, or NULL if @p size is too
+ *         large or all buffers are in use.
+ */
+void *ili9163c_buf_acquire(size_t size);
+
+/**
+ * @brief Release a buffer acquired with ili9163c_buf_acquire().
+ *
+ * @param buf Buffer.
+ */
+void ili9163c_buf_release(void *buf);
+
+/**
+ * @brief Get the bounce buffer pool statistics.
+ *
+ * @param stats Statistics output.
+ */
+void ili9163c_buf_get_stats(struct ili9163c_buf_stats *stats);
+
+/**
+ * @brief Hook invoked after each successful display write.
+ *
+ * Called from the writing thread with the driver lock held, right after the
+ * pixels were sent to the controller, so it observes writes in bus order. It
+ * must not block nor call back into the driver.
+ *
+ * @param dev ILI9163C display device.
+ * @param x X coordinate of the written area.
+ * @param y Y coordinate of the written area.
+ * @param desc Descriptor of the written buffer.
+ * @param buf Written pixels, in @p pixel_format with the display byte order.
+ * @param pixel_format Current pixel format of the display.
+ * @param user_data User data given at registration.
+ */
+typedef void (*ili9163c_write_hook_t)(const struct device *dev, uint16_t x, uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf, enum display_pixel_format pixel_format,
+				      void *user_data);
+
+/**
+ * @brief Set the hook invoked after each successful display write.
+ *
+ * Requires CONFIG_ILI9163C_WRITE_HOOK.
+ *
+ * @param dev ILI9163C display device.
+ * @param hook Hook, NULL to disable.
+ * @param user_data User data passed to the hook.
+ */
+void ili9163c_set_write_hook(const struct device *dev, ili9163c_write_hook_t hook,
+			     void *user_data);
+
+/** Present scheduler statistics. Durations are in hardware cycles. */
+struct ili9163c_present_stats {
+	/** Present rate, in Hz. */
+	uint16_t rate_hz;
+	/** Frame interval. */
+	uint32_t period_cycles;
+	/** Frame intervals in which changed areas were sent. */
+	uint32_t frames;
+	/** Frame intervals without any change. */
+	uint32_t idle;
+	/**
+	 * Frames sent after the end of their interval, and intervals skipped
+	 * while a previous frame was still being sent.
+	 */
+	uint32_t missed;
+	/** Display writes coalesced into frames. */
+	uint32_t writes;
+	/** Pixels submitted by display writes. */
+	uint64_t submitted_pixels;
+	/**
+	 * Pixels sent to the panel: fewer than submitted when content was
+	 * overwritten within an interval, more when merged areas include
+	 * unchanged pixels.
+	 */
+	uint64_t sent_pixels;
+	/** Time spent in display_write() copying into the shadow framebuffer. */
+	uint64_t render_cycles;
+	/** Time spent sending frames, total and longest. */
+	uint64_t transfer_cycles;
+	uint32_t max_transfer_cycles;
+	/** Time left in the interval after each frame was sent, total and smallest. */
+	uint64_t slack_cycles;
+	uint32_t min_slack_cycles;
+};
+
+/**
+ * @brief Start presenting at a fixed rate.
+ *
+ * Display writes are then copied into the shadow framebuffer of the driver and
+ * return without bus traffic. At each frame interval, the areas changed since
+ * the previous interval are sent to the panel from the shadow framebuffer, so
+ * that all the writes of an interval are coalesced and content overwritten
+ * within an interval is never sent. Pixel format and orientation cannot be
+ * changed while presenting.
+ *
+ * Writes are not copied into the shadow framebuffer while the scheduler is
+ * stopped, so its content is stale on start: the caller redraws the whole
+ * screen after starting, before relying on partial updates.
+ *
+ * Requires CONFIG_ILI9163C_PRESENT.
+ *
+ * @param dev ILI9163C display device.
+ * @param rate_hz Present rate, 0 for the panel frame rate programmed in FRMCTR1.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if already presenting.
+ * @retval -EINVAL if the rate is invalid.
+ * @retval -ENOTSUP if the instance has no present-shadow property, or if the
+ *         current pixel format is RGB888 but the devicetree one is not.
+ */
+int ili9163c_present_start(const struct device *dev, uint16_t rate_hz);
+
+/**
+ * @brief Stop presenting, display writes are sent directly again.
+ *
+ * Pending changes are sent before returning.
+ *
+ * @param dev ILI9163C display device.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if not presenting.
+ * @retval -errno Negative errno code if pending changes could not be sent.
+ */
+int ili9163c_present_stop(const struct device *dev);
+
+/**
+ * @brief Get the present scheduler statistics since the last start or reset.
+ *
+ * @param dev ILI9163C display device.
+ * @param stats Statistics output.
+ */
+void ili9163c_get_present_stats(const struct device *dev, struct ili9163c_present_stats *stats);
+
+/**
+ * @brief Reset the present scheduler statistics.
+ *
+ * @param dev ILI9163C display device.
+ */
+void ili9163c_reset_present_stats(const struct device *dev);
+
+/**
+ * @name Bus recording format.
+ *
+ * A recording starts with ILI9163C_RECORD_HEADER followed by the version
+ * (u8), the panel width and height before rotation (u16), MADCTL and PIXSET
+ * as programmed when the recording started (u8), the bus frequency in Hz
+ * (u32) and the timestamp frequency in Hz (u32). Each transaction is then a
+ * record made of its type (u8), the timestamp increment since the previous
+ * record (varint), an argument (u8), a length (varint) and, for commands and
+ * display data, the bytes sent:
+ *
+ * - ILI9163C_RECORD_COMMAND: command byte sent with D/C low, followed by its
+ *   parameters sent with D/C high.
+ * - ILI9163C_RECORD_DATA: pixel format on the bus (0 for RGB565, 1 for
+ *   RGB888, 2 for RGB444 with 2 pixels in 3 bytes), display data sent with
+ *   D/C high.
+ * - ILI9163C_RECORD_READ: command byte, number of bytes read (not recorded).
+ * - ILI9163C_RECORD_RESET: reset pulse in ms, no length.
+ *
+ * Multi-byte fields are little endian. Varints are unsigned LEB128, 7 bits
+ * per byte, least significant first. scripts/ili9163c_record.py replays and
+ * compares recordings.
+ * @{
+ */
+#define ILI9163C_RECORD_HEADER  'H'
+#define ILI9163C_RECORD_COMMAND 'C'
+#define ILI9163C_RECORD_DATA    'D'
+#define ILI9163C_RECORD_READ    'R'
+#define ILI9163C_RECORD_RESET   'X'
+#define ILI9163C_RECORD_VERSION 1
+/** @} */
+
+/**
+ * @brief Recording sink.
+ *
+ * Called from the thread performing the transaction, with the driver lock
+ * held. Blocking delays the bus traffic but not its recorded content.
+ *
+ * @param data Recording bytes.
+ * @param len Number of bytes.
+ * @param user_data User data given to ili9163c_record_start().
+ *
+ * @retval 0 on success.
+ * @retval -errno Negative errno code on failure, recording then stops.
+ */
+typedef int (*ili9163c_record_sink_t)(const uint8_t *data, size_t len, void *user_data);
+
+/** Recording statistics. */
+struct ili9163c_record_stats {
+	/** Command writes recorded. */
+	uint32_t commands;
+	/** Display data writes recorded. */
+	uint32_t writes;
+	/** Command reads recorded. */
+	uint32_t reads;
+	/** Command and parameter bytes recorded. */
+	uint64_t command_bytes;
+	/** Display data bytes recorded. */
+	uint64_t data_bytes;
+	/** Bytes sent to the sink. */
+	uint64_t stream_bytes;
+	/** Error of the sink that stopped the recording, 0 if none. */
+	int error;
+};
+
+/**
+ * @brief Start recording the bus transactions of a display.
+ *
+ * Requires CONFIG_ILI9163C_RECORD.
+ *
+ * @param dev ILI9163C display device.
+ * @param sink Recording sink.
+ * @param user_data User data passed to the sink.
+ *
+ * @retval 0 on success.
+ * @retval -EBUSY if already recording.
+ * @retval -errno Negative errno code if the header could not be sent.
+ */
+int ili9163c_record_start(const struct device *dev, ili9163c_record_sink_t sink,
+			  void *user_data);
+
+/**
+ * @brief Stop recording, the buffered records are sent to the sink.
+ *
+ * @param dev ILI9163C display device.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if not recording.
+ * @retval -errno Negative errno code of the sink failure that stopped the
+ *         recording.
+ */
+int ili9163c_record_stop(const struct device *dev);
+
+/**
+ * @brief Get the statistics of the current or last recording.
+ *
+ * @param dev ILI9163C display device.
+ * @param stats Statistics output.
+ */
+void ili9163c_get_record_stats(const struct device *dev, struct ili9163c_record_stats *stats);
+
+/**
+ * @brief Sink printing the recording on the console.
+ *
+ * Bytes are printed in hexadecimal, on lines starting with
+ * ILI9163C_RECORD_CONSOLE_PREFIX, so that the recording of a native_sim run
+ * can be extracted from its output. @p user_data is unused.
+ */
+int ili9163c_record_console_sink(const uint8_t *data, size_t len, void *user_data);
+
+/** Prefix of the console sink lines. */
+#define ILI9163C_RECORD_CONSOLE_PREFIX "ili9163c-record: "
+
+#ifdef CONFIG_FILE_SYSTEM
+/**
+ * @brief Sink writing the recording to a file.
+ *
+ * @p user_data is the opened struct fs_file_t.
+ */
+int ili9163c_record_fs_sink(const uint8_t *data, size_t len, void *user_data);
+#endif
+
+/**
+ * @brief Enable or disable the 12-bit RGB444 interface mode.
+ *
+ * Display writes keep taking the current pixel format, RGB565 or RGB888. In
+ * RGB444 mode the driver keeps the 4 most significant bits of each channel
+ * and sends 2 pixels in 3 bytes, 25% less than RGB565 and 50% less than
+ * RGB888. The mode is enabled at boot with
+ * pixel-format = <ILI9163C_PIXEL_FORMAT_RGB444> in devicetree.
+ *
+ * Requires CONFIG_ILI9163C_RGB444.
+ *
+ * @param dev ILI9163C display device.
+ * @param enable True to send 12-bit pixels, false to send the pixel format.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the mode differs from devicetree with
+ *         CONFIG_ILI9163C_FIXED_CONFIG.
+ * @retval -errno Negative errno code on other failure.
+ */
+int ili9163c_set_rgb444(const struct device *dev, bool enable);
+
+/**
+ * @brief Get whether the 12-bit RGB444 interface mode is enabled.
+ *
+ * @param dev ILI9163C display device.
+ */
+bool ili9163c_get_rgb444(const struct device *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_H_ */
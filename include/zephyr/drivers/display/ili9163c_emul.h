@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_EMUL_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_EMUL_H_
+
+#include <zephyr/drivers/emul.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Faults that can be injected in the ILI9163C emulator. */
+enum ili9163c_emul_fault {
+	/** Corrupt the memory access control register. */
+	ILI9163C_EMUL_FAULT_MADCTL,
+	/** Corrupt the pixel format register. */
+	ILI9163C_EMUL_FAULT_PIXSET,
+	/** Toggle display inversion. */
+	ILI9163C_EMUL_FAULT_INVERSION,
+	/** Turn the display off. */
+	ILI9163C_EMUL_FAULT_DISPLAY_OFF,
+	/** Reset the controller: registers back to defaults, sleep in, GRAM cleared. */
+	ILI9163C_EMUL_FAULT_RESET,
+};
+
+/** Controller state seen by the ILI9163C emulator. */
+struct ili9163c_emul_state {
+	uint8_t madctl;
+	uint8_t pixset;
+	bool inversion;
+	bool display_on;
+	bool sleep_out;
+};
+
+/**
+ * @brief Inject a fault in the emulated controller.
+ *
+ * @param target ILI9163C emulator.
+ * @param fault Fault to inject.
+ */
+void ili9163c_emul_inject_fault(const struct emul *target, enum ili9163c_emul_fault fault);
+
+/**
+ * @brief Get the state of the emulated controller.
+ *
+ * @param target ILI9163C emulator.
+ * @param state State output.
+ */
+void ili9163c_emul_get_state(const struct emul *target, struct ili9163c_emul_state *state);
+
+/**
+ * @brief Get a pixel of the emulated GRAM.
+ *
+ * Channels keep the bits received in the current interface mode, left
+ * aligned: 5, 6 and 5 bits in 16-bit mode, 6 bits in 18-bit mode and 4 bits
+ * in 12-bit mode.
+ *
+ * @param target ILI9163C emulator.
+ * @param x GRAM column, before rotation.
+ * @param y GRAM row, before rotation.
+ * @param rgb Red, green and blue output, 0 outside of the GRAM.
+ */
+void ili9163c_emul_get_pixel(const struct emul *target, uint16_t x, uint16_t y, uint8_t rgb[3]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DISPLAY_ILI9163C_EMUL_H_ */
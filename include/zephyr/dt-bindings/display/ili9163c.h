@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DT_BINDINGS_DISPLAY_ILI9163C_H_
+#define ZEPHYR_INCLUDE_DT_BINDINGS_DISPLAY_ILI9163C_H_
+
+/* Values of the ilitek,ili9163c pixel-format property. */
+#define ILI9163C_PIXEL_FORMAT_RGB565 0
+#define ILI9163C_PIXEL_FORMAT_RGB888 1
+#define ILI9163C_PIXEL_FORMAT_RGB444 2
+
+#endif /* ZEPHYR_INCLUDE_DT_BINDINGS_DISPLAY_ILI9163C_H_ */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/display/ili9163c_area.h>
+
+bool ili9163c_area_add(struct ili9163c_area *list, uint8_t *count, uint8_t max,
+		       const struct ili9163c_area *area)
+{
+	struct ili9163c_area merged;
+	uint32_t best_waste = UINT32_MAX;
+	uint32_t waste;
+	uint32_t size;
+	uint8_t best = 0U;
+
+	if ((area->x0 >= area->x1) || (area->y0 >= area->y1)) {
+		return false;
+	}
+
+	for (uint8_t i = 0U; i < *count; i++) {
+		merged = list[i];
+		ili9163c_area_union(&merged, area);
+
+		size = ili9163c_area_size(&list[i]) + ili9163c_area_size(area);
+		waste = ili9163c_area_size(&merged);
+		waste = (waste > size) ? (waste - size) : 0U;
+
+		if (waste < best_waste) {
+			best_waste = waste;
+			best = i;
+		}
+	}
+
+	if ((best_waste > 0U) && (*count < max)) {
+		list[(*count)++] = *area;
+		return false;
+	}
+
+	ili9163c_area_union(&list[best], area);
+
+	return true;
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/display/ili9163c_bands.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ili9163c_bands, CONFIG_DISPLAY_LOG_LEVEL);
+
+#define ILI9163C_BANDS_STOP UINT16_MAX
+
+/** Band to render, into buffer band % CONFIG_ILI9163C_BANDS_BUFFERS. */
+struct ili9163c_bands_job {
+	uint32_t frame;
+	uint16_t band;
+};
+
+struct ili9163c_bands {
+	struct ili9163c_bands_config config;
+	struct display_buffer_descriptor desc;
+	uint16_t height;
+	uint16_t band_count;
+	bool running;
+	struct ili9163c_bands_stats stats;
+};
+
+static struct ili9163c_bands ili9163c_bands;
+static uint8_t ili9163c_bands_bufs[CONFIG_ILI9163C_BANDS_BUFFERS]
+				  [CONFIG_ILI9163C_BANDS_BUFFER_SIZE] __aligned(4);
+static struct k_sem ili9163c_bands_ready[CONFIG_ILI9163C_BANDS_BUFFERS];
+
+K_MSGQ_DEFINE(ili9163c_bands_jobs, sizeof(struct ili9163c_bands_job),
+	      CONFIG_ILI9163C_BANDS_BUFFERS + CONFIG_ILI9163C_BANDS_MAX_WORKERS, 4);
+K_MUTEX_DEFINE(ili9163c_bands_lock);
+
+static K_THREAD_STACK_ARRAY_DEFINE(ili9163c_bands_stacks, CONFIG_ILI9163C_BANDS_MAX_WORKERS,
+				   CONFIG_ILI9163C_BANDS_STACK_SIZE);
+static struct k_thread ili9163c_bands_threads[CONFIG_ILI9163C_BANDS_MAX_WORKERS];
+
+static void ili9163c_bands_worker(void *p1, void *p2, void *p3)
+{
+	struct ili9163c_bands *bands = p1;
+	struct display_buffer_descriptor desc = bands->desc;
+	struct ili9163c_bands_job job;
+	uint16_t slot;
+	uint16_t y;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msgq_get(&ili9163c_bands_jobs, &job, K_FOREVER);
+		if (job.band == ILI9163C_BANDS_STOP) {
+			break;
+		}
+
+		slot = job.band % CONFIG_ILI9163C_BANDS_BUFFERS;
+		y = job.band * bands->desc.height;
+		desc.height = MIN(bands->desc.height, bands->height - y);
+
+		bands->config.render(ili9163c_bands_bufs[slot], &desc, y, job.frame,
+				     bands->config.user_data);
+
+		k_sem_give(&ili9163c_bands_ready[slot]);
+	}
+}
+
+static void ili9163c_bands_queue(uint32_t frame, uint16_t band)
+{
+	const struct ili9163c_bands_job job = {.frame = frame, .band = band};
+
+	/* Never blocks: at most one job per buffer is queued, plus the stop jobs. */
+	k_msgq_put(&ili9163c_bands_jobs, &job, K_FOREVER);
+}
+
+int ili9163c_bands_start(const struct ili9163c_bands_config *config)
+{
+	struct ili9163c_bands *bands = &ili9163c_bands;
+	struct display_capabilities capabilities;
+	size_t row_size;
+	uint8_t workers;
+	int r = 0;
+
+	workers = (config->workers != 0U) ? config->workers
+					  : MIN(CONFIG_MP_MAX_NUM_CPUS,
+						CONFIG_ILI9163C_BANDS_MAX_WORKERS);
+	if ((config->render == NULL) || (workers > CONFIG_ILI9163C_BANDS_MAX_WORKERS)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&ili9163c_bands_lock, K_FOREVER);
+
+	if (bands->running) {
+		r = -EBUSY;
+		goto out;
+	}
+
+	display_get_capabilities(config->display, &capabilities);
+	switch (capabilities.current_pixel_format) {
+	case PIXEL_FORMAT_RGB_565:
+		row_size = capabilities.x_resolution * 2U;
+		break;
+	case PIXEL_FORMAT_RGB_888:
+		row_size = capabilities.x_resolution * 3U;
+		break;
+	default:
+		LOG_ERR("Unsupported pixel format");
+		r = -EINVAL;
+		goto out;
+	}
+
+	if (row_size > CONFIG_ILI9163C_BANDS_BUFFER_SIZE) {
+		LOG_ERR("Buffers are smaller than a row");
+		r = -EINVAL;
+		goto out;
+	}
+
+	memset(bands, 0, sizeof(*bands));
+	bands->config = *config;
+	bands->config.workers = workers;
+	bands->height = capabilities.y_resolution;
+	bands->desc.width = capabilities.x_resolution;
+	bands->desc.pitch = capabilities.x_resolution;
+	bands->desc.height = MIN(CONFIG_ILI9163C_BANDS_BUFFER_SIZE / row_size, bands->height);
+	bands->desc.buf_size = bands->desc.height * row_size;
+	bands->band_count = DIV_ROUND_UP(bands->height, bands->desc.height);
+	bands->stats.band_rows = bands->desc.height;
+
+	k_msgq_purge(&ili9163c_bands_jobs);
+	for (int i = 0; i < CONFIG_ILI9163C_BANDS_BUFFERS; i++) {
+		k_sem_init(&ili9163c_bands_ready[i], 0, 1);
+	}
+
+	for (uint8_t i = 0U; i < workers; i++) {
+		k_thread_create(&ili9163c_bands_threads[i], ili9163c_bands_stacks[i],
+				K_THREAD_STACK_SIZEOF(ili9163c_bands_stacks[i]),
+				ili9163c_bands_worker, bands, NULL, NULL,
+				CONFIG_ILI9163C_BANDS_PRIORITY, 0, K_FOREVER);
+		k_thread_name_set(&ili9163c_bands_threads[i], "ili9163c_bands");
+#ifdef CONFIG_SCHED_CPU_MASK
+		k_thread_cpu_pin(&ili9163c_bands_threads[i], i % CONFIG_MP_MAX_NUM_CPUS);
+#endif
+		k_thread_start(&ili9163c_bands_threads[i]);
+	}
+
+	bands->running = true;
+
+out:
+	k_mutex_unlock(&ili9163c_bands_lock);
+
+	return r;
+}
+
+int ili9163c_bands_frame(uint32_t frame)
+{
+	struct ili9163c_bands *bands = &ili9163c_bands;
+	struct display_buffer_descriptor desc;
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+	uint32_t wait;
+	uint16_t slot;
+	uint16_t y;
+	int r = 0;
+	int ret;
+
+	k_mutex_lock(&ili9163c_bands_lock, K_FOREVER);
+
+	if (!bands->running) {
+		k_mutex_unlock(&ili9163c_bands_lock);
+		return -EALREADY;
+	}
+
+	desc = bands->desc;
+
+	for (uint16_t band = 0U; band < MIN(bands->band_count, CONFIG_ILI9163C_BANDS_BUFFERS);
+	     band++) {
+		ili9163c_bands_queue(frame, band);
+	}
+
+	for (uint16_t band = 0U; band < bands->band_count; band++) {
+		slot = band % CONFIG_ILI9163C_BANDS_BUFFERS;
+		y = band * bands->desc.height;
+
+		wait = k_cycle_get_32();
+		k_sem_take(&ili9163c_bands_ready[slot], K_FOREVER);
+		bands->stats.stall_cycles += k_cycle_get_32() - wait;
+
+		/* Bands are always consumed, so the ring stays consistent after an error. */
+		desc.height = MIN(bands->desc.height, bands->height - y);
+		ret = display_write(bands->config.display, 0U, y, &desc, ili9163c_bands_bufs[slot]);
+		if ((ret < 0) && (r == 0)) {
+			LOG_ERR("Could not write band %u (%d)", band, ret);
+			r = ret;
+		}
+
+		if (band + CONFIG_ILI9163C_BANDS_BUFFERS < bands->band_count) {
+			ili9163c_bands_queue(frame, band + CONFIG_ILI9163C_BANDS_BUFFERS);
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+	bands->stats.frames++;
+	bands->stats.frame_cycles += cycles;
+	bands->stats.max_frame_cycles = MAX(bands->stats.max_frame_cycles, cycles);
+
+	k_mutex_unlock(&ili9163c_bands_lock);
+
+	return r;
+}
+
+int ili9163c_bands_stop(void)
+{
+	struct ili9163c_bands *bands = &ili9163c_bands;
+
+	k_mutex_lock(&ili9163c_bands_lock, K_FOREVER);
+
+	if (!bands->running) {
+		k_mutex_unlock(&ili9163c_bands_lock);
+		return -EALREADY;
+	}
+
+	for (uint8_t i = 0U; i < bands->config.workers; i++) {
+		ili9163c_bands_queue(0U, ILI9163C_BANDS_STOP);
+	}
+
+	for (uint8_t i = 0U; i < bands->config.workers; i++) {
+		k_thread_join(&ili9163c_bands_threads[i], K_FOREVER);
+	}
+
+	bands->running = false;
+
+	k_mutex_unlock(&ili9163c_bands_lock);
+
+	return 0;
+}
+
+void ili9163c_bands_get_stats(struct ili9163c_bands_stats *stats)
+{
+	k_mutex_lock(&ili9163c_bands_lock, K_FOREVER);
+	*stats = ili9163c_bands.stats;
+	k_mutex_unlock(&ili9163c_bands_lock);
+}
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/display/ili9163c_area.h>
+#include <zephyr/display/ili9163c_compose.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ili9163c_compose, CONFIG_DISPLAY_LOG_LEVEL);
+
+/** Layer fields as of the last update. */
+struct ili9163c_compose_drawn {
+	const uint8_t *pixels;
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+	bool visible;
+};
+
+struct ili9163c_compose {
+	struct ili9163c_compose_config config;
+	uint16_t width;
+	uint16_t height;
+	/* Bytes per pixel. */
+	size_t bpp;
+	uint8_t color[3];
+	struct ili9163c_compose_drawn drawn[CONFIG_ILI9163C_COMPOSE_MAX_LAYERS];
+	/* Transparent color of each layer, in display byte order. */
+	uint8_t keys[CONFIG_ILI9163C_COMPOSE_MAX_LAYERS][3];
+	struct ili9163c_area dirty[CONFIG_ILI9163C_COMPOSE_DIRTY_RECTS];
+	uint8_t dirty_count;
+	struct ili9163c_compose_stats stats;
+};
+
+static struct ili9163c_compose ili9163c_compose;
+static uint8_t ili9163c_compose_buf[CONFIG_ILI9163C_COMPOSE_BUFFER_SIZE] __aligned(4);
+
+K_MUTEX_DEFINE(ili9163c_compose_lock);
+
+static void ili9163c_compose_set_full(struct ili9163c_compose *comp)
+{
+	comp->dirty[0] = (struct ili9163c_area){0U, 0U, comp->width, comp->height};
+	comp->dirty_count = 1U;
+}
+
+static void ili9163c_compose_add_dirty(struct ili9163c_compose *comp,
+				       const struct ili9163c_area *area)
+{
+	ili9163c_area_add(comp->dirty, &comp->dirty_count, ARRAY_SIZE(comp->dirty), area);
+}
+
+/* Area covered by a layer, clipped to the screen. */
+static void ili9163c_compose_layer_area(const struct ili9163c_compose *comp,
+					const struct ili9163c_compose_drawn *drawn,
+					struct ili9163c_area *area)
+{
+	area->x0 = CLAMP(drawn->x, 0, comp->width);
+	area->y0 = CLAMP(drawn->y, 0, comp->height);
+	area->x1 = CLAMP(drawn->x + drawn->width, 0, comp->width);
+	area->y1 = CLAMP(drawn->y + drawn->height, 0, comp->height);
+}
+
+static void ili9163c_compose_color(uint8_t *dst, enum display_pixel_format pixel_format,
+				   uint32_t rgb)
+{
+	if (pixel_format == PIXEL_FORMAT_RGB_565) {
+		sys_put_be16(((rgb >> 8) & 0xF800U) | ((rgb >> 5) & 0x07E0U) |
+				     ((rgb >> 3) & 0x001FU),
+			     dst);
+	} else {
+		sys_put_be24(rgb, dst);
+	}
+}
+
+/* Compose columns x0 to x1 of row y. */
+static void ili9163c_compose_row(const struct ili9163c_compose *comp, uint8_t *dst, uint16_t y,
+				 uint16_t x0, uint16_t x1)
+{
+	const struct ili9163c_layer *layer;
+	size_t bpp = comp->bpp;
+	const uint8_t *key;
+	const uint8_t *src;
+	uint8_t *out;
+	int32_t start;
+	int32_t end;
+
+	if (comp->config.background != NULL) {
+		memcpy(dst, &comp->config.background[((size_t)y * comp->width + x0) * bpp],
+		       (x1 - x0) * bpp);
+	} else {
+		for (uint16_t x = x0; x < x1; x++) {
+			memcpy(&dst[(x - x0) * bpp], comp->color, bpp);
+		}
+	}
+
+	for (uint8_t i = 0U; i < comp->config.layer_count; i++) {
+		layer = &comp->config.layers[i];
+		if (!layer->visible || (y < layer->y) || (y >= layer->y + layer->height)) {
+			continue;
+		}
+
+		start = MAX(layer->x, x0);
+		end = MIN(layer->x + layer->width, x1);
+		if (start >= end) {
+			continue;
+		}
+
+		src = &layer->pixels[((size_t)(y - layer->y) *
+					      ((layer->pitch != 0U) ? layer->pitch : layer->width) +
+				      (start - layer->x)) *
+				     bpp];
+		out = &dst[(start - x0) * bpp];
+
+		if (!layer->keyed) {
+			memcpy(out, src, (end - start) * bpp);
+			continue;
+		}
+
+		key = comp->keys[i];
+		if (bpp == 2U) {
+			for (int32_t x = start; x < end; x++, src += 2, out += 2) {
+				if ((src[0] != key[0]) || (src[1] != key[1])) {
+					out[0] = src[0];
+					out[1] = src[1];
+				}
+			}
+		} else {
+			for (int32_t x = start; x < end; x++, src += 3, out += 3) {
+				if ((src[0] != key[0]) || (src[1] != key[1]) ||
+				    (src[2] != key[2])) {
+					out[0] = src[0];
+					out[1] = src[1];
+					out[2] = src[2];
+				}
+			}
+		}
+	}
+}
+
+/* Compose and write an area, as many rows at a time as the line buffer holds. */
+static int ili9163c_compose_write_area(struct ili9163c_compose *comp,
+				       const struct ili9163c_area *area)
+{
+	struct display_buffer_descriptor desc;
+	size_t row_size = (area->x1 - area->x0) * comp->bpp;
+	uint16_t rows = MIN(sizeof(ili9163c_compose_buf) / row_size, area->y1 - area->y0);
+	int r;
+
+	desc.width = area->x1 - area->x0;
+	desc.pitch = desc.width;
+
+	for (uint16_t y = area->y0; y < area->y1; y += desc.height) {
+		desc.height = MIN(rows, area->y1 - y);
+		desc.buf_size = desc.height * row_size;
+
+		for (uint16_t row = 0U; row < desc.height; row++) {
+			ili9163c_compose_row(comp, &ili9163c_compose_buf[row * row_size], y + row,
+					     area->x0, area->x1);
+		}
+
+		r = display_write(comp->config.display, area->x0, y, &desc, ili9163c_compose_buf);
+		comp->stats.writes++;
+		if (r < 0) {
+			return r;
+		}
+
+		comp->stats.pixels += desc.width * desc.height;
+	}
+
+	return 0;
+}
+
+static void ili9163c_compose_get_drawn(const struct ili9163c_layer *layer,
+				       struct ili9163c_compose_drawn *drawn)
+{
+	drawn->pixels = layer->pixels;
+	drawn->x = layer->x;
+	drawn->y = layer->y;
+	drawn->width = layer->width;
+	drawn->height = layer->height;
+	drawn->visible = layer->visible;
+}
+
+static bool ili9163c_compose_changed(const struct ili9163c_compose_drawn *drawn,
+				     const struct ili9163c_compose_drawn *prev)
+{
+	return (drawn->pixels != prev->pixels) || (drawn->x != prev->x) || (drawn->y != prev->y) ||
+	       (drawn->width != prev->width) || (drawn->height != prev->height) ||
+	       (drawn->visible != prev->visible);
+}
+
+int ili9163c_compose_init(const struct ili9163c_compose_config *config)
+{
+	struct ili9163c_compose *comp = &ili9163c_compose;
+	struct display_capabilities capabilities;
+	size_t bpp;
+
+	if ((config->display == NULL) ||
+	    (config->layer_count > CONFIG_ILI9163C_COMPOSE_MAX_LAYERS) ||
+	    ((config->layers == NULL) && (config->layer_count != 0U))) {
+		return -EINVAL;
+	}
+
+	display_get_capabilities(config->display, &capabilities);
+	switch (capabilities.current_pixel_format) {
+	case PIXEL_FORMAT_RGB_565:
+		bpp = 2U;
+		break;
+	case PIXEL_FORMAT_RGB_888:
+		bpp = 3U;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	if (capabilities.x_resolution * bpp > CONFIG_ILI9163C_COMPOSE_BUFFER_SIZE) {
+		LOG_ERR("Line buffer is smaller than a row");
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&ili9163c_compose_lock, K_FOREVER);
+
+	memset(comp, 0, sizeof(*comp));
+	comp->config = *config;
+	comp->width = capabilities.x_resolution;
+	comp->height = capabilities.y_resolution;
+	comp->bpp = bpp;
+	ili9163c_compose_color(comp->color, capabilities.current_pixel_format,
+			       config->background_color);
+
+	for (uint8_t i = 0U; i < config->layer_count; i++) {
+		ili9163c_compose_get_drawn(&config->layers[i], &comp->drawn[i]);
+	}
+
+	ili9163c_compose_set_full(comp);
+
+	k_mutex_unlock(&ili9163c_compose_lock);
+
+	return 0;
+}
+
+int ili9163c_compose_update(void)
+{
+	struct ili9163c_compose *comp = &ili9163c_compose;
+	const struct ili9163c_layer *layer;
+	struct ili9163c_compose_drawn drawn;
+	struct ili9163c_area area;
+	int r = 0;
+
+	k_mutex_lock(&ili9163c_compose_lock, K_FOREVER);
+
+	if (comp->config.display == NULL) {
+		k_mutex_unlock(&ili9163c_compose_lock);
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0U; i < comp->config.layer_count; i++) {
+		layer = &comp->config.layers[i];
+		ili9163c_compose_get_drawn(layer, &drawn);
+
+		if (ili9163c_compose_changed(&drawn, &comp->drawn[i])) {
+			if (comp->drawn[i].visible) {
+				ili9163c_compose_layer_area(comp, &comp->drawn[i], &area);
+				ili9163c_compose_add_dirty(comp, &area);
+			}
+			if (drawn.visible) {
+				ili9163c_compose_layer_area(comp, &drawn, &area);
+				ili9163c_compose_add_dirty(comp, &area);
+			}
+			comp->drawn[i] = drawn;
+		}
+
+		if (comp->bpp == 2U) {
+			sys_put_be16(layer->key, comp->keys[i]);
+		} else {
+			sys_put_be24(layer->key, comp->keys[i]);
+		}
+	}
+
+	for (uint8_t i = 0U; i < comp->dirty_count; i++) {
+		r = ili9163c_compose_write_area(comp, &comp->dirty[i]);
+		if (r < 0) {
+			LOG_ERR("Could not write area (%d)", r);
+			break;
+		}
+		comp->stats.areas++;
+	}
+
+	if (r < 0) {
+		ili9163c_compose_set_full(comp);
+	} else {
+		comp->dirty_count = 0U;
+	}
+
+	comp->stats.updates++;
+
+	k_mutex_unlock(&ili9163c_compose_lock);
+
+	return r;
+}
+
+void ili9163c_compose_invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	struct ili9163c_compose *comp = &ili9163c_compose;
+	struct ili9163c_area area;
+
+	k_mutex_lock(&ili9163c_compose_lock, K_FOREVER);
+
+	area.x0 = MIN(x, comp->width);
+	area.y0 = MIN(y, comp->height);
+	area.x1 = MIN(x + width, comp->width);
+	area.y1 = MIN(y + height, comp->height);
+	ili9163c_compose_add_dirty(comp, &area);
+
+	k_mutex_unlock(&ili9163c_compose_lock);
+}
+
+void ili9163c_compose_get_stats(struct ili9163c_compose_stats *stats)
+{
+	k_mutex_lock(&ili9163c_compose_lock, K_FOREVER);
+	*stats = ili9163c_compose.stats;
+	k_mutex_unlock(&ili9163c_compose_lock);
+}
@@ -0,0 +1,876 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generated by scripts/ili9163c_font.py from DejaVuSansMono.ttf,
+ * size 13, 8x16 pixels, 4 bpp.
+ */
+
+#include <zephyr/display/ili9163c_text.h>
+
+static const uint8_t ili9163c_font_mono_8x16_aa_glyphs[] = {
+	/* 0x20 ' ' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x21 '!' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0a, 0x80, 0x00,
+	0x00, 0x09, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x22 '"' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x6a, 0x00,
+	0x00, 0xd4, 0x6a, 0x00, 0x00, 0xd4, 0x6a, 0x00,
+	0x00, 0xd4, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x23 '#' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x33, 0xc0, 0x00, 0x0e, 0x06, 0x90,
+	0x00, 0x3c, 0x0a, 0x50, 0x4f, 0xff, 0xff, 0xfc,
+	0x00, 0xb5, 0x2d, 0x00, 0x00, 0xe1, 0x69, 0x00,
+	0xff, 0xff, 0xff, 0xf1, 0x07, 0x80, 0xd2, 0x00,
+	0x0a, 0x52, 0xe0, 0x00, 0x0e, 0x25, 0xa0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x24 '$' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00,
+	0x01, 0xae, 0xe9, 0x10, 0x0a, 0xa4, 0x76, 0x60,
+	0x0b, 0x64, 0x60, 0x00, 0x04, 0xda, 0x81, 0x00,
+	0x00, 0x17, 0xbd, 0x60, 0x00, 0x04, 0x63, 0xf0,
+	0x09, 0x54, 0x67, 0xd0, 0x03, 0xae, 0xeb, 0x30,
+	0x00, 0x04, 0x60, 0x00, 0x00, 0x04, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x25 '%' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2c, 0xe7, 0x00, 0x00,
+	0xa5, 0x1c, 0x20, 0x00, 0xa5, 0x1c, 0x20, 0x11,
+	0x3c, 0xe7, 0x28, 0xa2, 0x00, 0x4a, 0x92, 0x00,
+	0x3b, 0x71, 0xae, 0xb1, 0x10, 0x05, 0xa1, 0x88,
+	0x00, 0x05, 0xa1, 0x88, 0x00, 0x00, 0xae, 0xb1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x26 '&' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0xf8, 0x00,
+	0x07, 0xc1, 0x00, 0x00, 0x04, 0xd1, 0x00, 0x00,
+	0x05, 0xeb, 0x00, 0x00, 0x3d, 0x1c, 0x70, 0x69,
+	0x88, 0x02, 0xe4, 0x77, 0x8a, 0x00, 0x5e, 0xd2,
+	0x3f, 0x61, 0x3d, 0xd0, 0x05, 0xce, 0xc6, 0xd6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x27 '\'' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x28 '(' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00,
+	0x00, 0x03, 0xd0, 0x00, 0x00, 0x09, 0x80, 0x00,
+	0x00, 0x0e, 0x40, 0x00, 0x00, 0x2f, 0x10, 0x00,
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00,
+	0x00, 0x2f, 0x10, 0x00, 0x00, 0x0e, 0x40, 0x00,
+	0x00, 0x09, 0x80, 0x00, 0x00, 0x03, 0xd0, 0x00,
+	0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x29 ')' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00,
+	0x00, 0x1e, 0x10, 0x00, 0x00, 0x0b, 0x70, 0x00,
+	0x00, 0x06, 0xb0, 0x00, 0x00, 0x04, 0xf0, 0x00,
+	0x00, 0x02, 0xf1, 0x00, 0x00, 0x02, 0xf1, 0x00,
+	0x00, 0x04, 0xf0, 0x00, 0x00, 0x06, 0xc0, 0x00,
+	0x00, 0x0b, 0x70, 0x00, 0x00, 0x1e, 0x10, 0x00,
+	0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2a '*' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
+	0x09, 0x47, 0x46, 0x70, 0x01, 0x8d, 0xc6, 0x00,
+	0x01, 0x8d, 0xc6, 0x00, 0x09, 0x47, 0x46, 0x70,
+	0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2b '+' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x70, 0x00, 0x00, 0x09, 0x70, 0x00,
+	0x00, 0x09, 0x70, 0x00, 0x7f, 0xff, 0xff, 0xf4,
+	0x00, 0x09, 0x70, 0x00, 0x00, 0x09, 0x70, 0x00,
+	0x00, 0x09, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2c ',' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0d, 0xa0, 0x00,
+	0x00, 0x1f, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2d '-' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xbf, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2e '.' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0xb0, 0x00, 0x00, 0x0d, 0xb0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x2f '/' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x7b, 0x00,
+	0x00, 0x00, 0xe4, 0x00, 0x00, 0x06, 0xc0, 0x00,
+	0x00, 0x0d, 0x50, 0x00, 0x00, 0x5d, 0x00, 0x00,
+	0x00, 0xc7, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x0a, 0x80, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x30 '0' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xe8, 0x00,
+	0x09, 0xd2, 0x3e, 0x60, 0x0e, 0x60, 0x08, 0xb0,
+	0x1f, 0x30, 0x06, 0xe0, 0x2f, 0x2a, 0x85, 0xf0,
+	0x1f, 0x30, 0x06, 0xe0, 0x0e, 0x60, 0x08, 0xb0,
+	0x09, 0xd2, 0x3e, 0x60, 0x01, 0xae, 0xe8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x31 '1' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00,
+	0x00, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xf0, 0x00,
+	0x00, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xf0, 0x00,
+	0x00, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xf0, 0x00,
+	0x00, 0x04, 0xf0, 0x00, 0x04, 0xff, 0xff, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x32 '2' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xbe, 0xd7, 0x00,
+	0x0b, 0x41, 0x4e, 0x60, 0x00, 0x00, 0x0b, 0x90,
+	0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x9b, 0x00,
+	0x00, 0x08, 0xc1, 0x00, 0x00, 0x8c, 0x10, 0x00,
+	0x08, 0xc1, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xb0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x33 '3' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xbe, 0xd7, 0x00,
+	0x09, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x0a, 0x90,
+	0x00, 0x00, 0x3e, 0x50, 0x00, 0x8f, 0xf8, 0x00,
+	0x00, 0x00, 0x3d, 0x70, 0x00, 0x00, 0x07, 0xc0,
+	0x29, 0x30, 0x3d, 0x90, 0x05, 0xce, 0xd9, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x34 '4' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x00,
+	0x00, 0x08, 0xce, 0x00, 0x00, 0x3c, 0x5e, 0x00,
+	0x00, 0xc3, 0x5e, 0x00, 0x07, 0x90, 0x5e, 0x00,
+	0x2d, 0x10, 0x5e, 0x00, 0x5f, 0xff, 0xff, 0xf3,
+	0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x35 '5' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x20,
+	0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00, 0x00,
+	0x0a, 0xef, 0xd7, 0x00, 0x00, 0x01, 0x5e, 0x60,
+	0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x09, 0xa0,
+	0x19, 0x21, 0x4e, 0x50, 0x06, 0xde, 0xd6, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x36 '6' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xf9, 0x10,
+	0x07, 0xd4, 0x15, 0x40, 0x0d, 0x50, 0x00, 0x00,
+	0x1f, 0x7d, 0xea, 0x10, 0x2f, 0xb2, 0x1c, 0xa0,
+	0x2f, 0x50, 0x05, 0xe0, 0x0e, 0x50, 0x05, 0xe0,
+	0x09, 0xc2, 0x1c, 0x90, 0x01, 0xae, 0xea, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x37 '7' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xc0,
+	0x00, 0x00, 0x0c, 0x70, 0x00, 0x00, 0x3f, 0x10,
+	0x00, 0x00, 0x9a, 0x00, 0x00, 0x01, 0xe4, 0x00,
+	0x00, 0x07, 0xd0, 0x00, 0x00, 0x0d, 0x70, 0x00,
+	0x00, 0x4f, 0x10, 0x00, 0x00, 0xaa, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x38 '8' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xbe, 0xe9, 0x10,
+	0x0b, 0xb1, 0x2c, 0x80, 0x0e, 0x50, 0x08, 0xb0,
+	0x09, 0xa1, 0x2c, 0x60, 0x01, 0xcf, 0xfa, 0x00,
+	0x0c, 0x91, 0x1b, 0xa0, 0x2f, 0x30, 0x05, 0xe0,
+	0x0e, 0x91, 0x1b, 0xc0, 0x03, 0xbe, 0xea, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x39 '9' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xbe, 0xe8, 0x00,
+	0x0d, 0x91, 0x3e, 0x60, 0x2f, 0x20, 0x08, 0xb0,
+	0x2f, 0x20, 0x08, 0xd0, 0x0d, 0x91, 0x3d, 0xe0,
+	0x03, 0xbe, 0xc8, 0xd0, 0x00, 0x00, 0x09, 0xa0,
+	0x06, 0x41, 0x5e, 0x30, 0x02, 0xbf, 0xc5, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3a ':' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xb0, 0x00,
+	0x00, 0x0d, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0xb0, 0x00, 0x00, 0x0d, 0xb0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3b ';' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xb0, 0x00,
+	0x00, 0x0d, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0d, 0xa0, 0x00,
+	0x00, 0x1f, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3c '<' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb4,
+	0x00, 0x39, 0xeb, 0x61, 0x4d, 0xc6, 0x10, 0x00,
+	0x4d, 0xc6, 0x10, 0x00, 0x00, 0x39, 0xeb, 0x51,
+	0x00, 0x00, 0x05, 0xb4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3d '=' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3e '>' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6a, 0x40, 0x00, 0x00,
+	0x16, 0xcd, 0x82, 0x00, 0x00, 0x02, 0x7d, 0xc2,
+	0x00, 0x02, 0x7d, 0xc2, 0x16, 0xcd, 0x82, 0x00,
+	0x6a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x3f '?' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x9d, 0xea, 0x10,
+	0x06, 0x61, 0x2d, 0x70, 0x00, 0x00, 0x0c, 0x70,
+	0x00, 0x00, 0xab, 0x10, 0x00, 0x09, 0xa0, 0x00,
+	0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x60, 0x00, 0x00, 0x0e, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x40 '@' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xec, 0x30,
+	0x09, 0xb3, 0x15, 0xd1, 0x3d, 0x00, 0x00, 0x95,
+	0x97, 0x06, 0xed, 0xa7, 0xb4, 0x3d, 0x21, 0xc7,
+	0xc2, 0x5a, 0x00, 0x77, 0xb3, 0x3d, 0x21, 0xc7,
+	0x87, 0x06, 0xed, 0xa7, 0x3d, 0x10, 0x00, 0x00,
+	0x07, 0xd4, 0x10, 0x00, 0x00, 0x5b, 0xee, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x41 'A' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+	0x00, 0x5d, 0xe3, 0x00, 0x00, 0xa8, 0xb7, 0x00,
+	0x01, 0xe4, 0x7c, 0x00, 0x05, 0xe0, 0x2f, 0x20,
+	0x0a, 0xb0, 0x0d, 0x70, 0x0e, 0xff, 0xff, 0xc0,
+	0x4f, 0x10, 0x04, 0xf2, 0x9b, 0x00, 0x00, 0xe6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x42 'B' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xea, 0x10,
+	0x0e, 0x50, 0x1b, 0xa0, 0x0e, 0x50, 0x07, 0xd0,
+	0x0e, 0x50, 0x2b, 0x90, 0x0e, 0xff, 0xfc, 0x10,
+	0x0e, 0x50, 0x18, 0xd0, 0x0e, 0x50, 0x02, 0xf3,
+	0x0e, 0x50, 0x18, 0xe1, 0x0e, 0xff, 0xec, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x43 'C' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0x40,
+	0x05, 0xe6, 0x13, 0x90, 0x0c, 0x90, 0x00, 0x00,
+	0x1f, 0x50, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00,
+	0x0f, 0x50, 0x00, 0x00, 0x0c, 0x90, 0x00, 0x00,
+	0x04, 0xf6, 0x13, 0x80, 0x00, 0x5c, 0xfc, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x44 'D' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0xfe, 0xb4, 0x00,
+	0x2f, 0x22, 0x6f, 0x40, 0x2f, 0x20, 0x09, 0xb0,
+	0x2f, 0x20, 0x06, 0xe0, 0x2f, 0x20, 0x05, 0xf0,
+	0x2f, 0x20, 0x06, 0xe0, 0x2f, 0x20, 0x09, 0xb0,
+	0x2f, 0x21, 0x6f, 0x40, 0x2f, 0xfe, 0xb4, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x45 'E' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xd0,
+	0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00,
+	0x0b, 0x80, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xa0,
+	0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00,
+	0x0b, 0x80, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x46 'F' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf1,
+	0x08, 0xc0, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00,
+	0x08, 0xc0, 0x00, 0x00, 0x08, 0xff, 0xff, 0xa0,
+	0x08, 0xc0, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00,
+	0x08, 0xc0, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x47 'G' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xeb, 0x20,
+	0x08, 0xd4, 0x14, 0x70, 0x1f, 0x50, 0x00, 0x00,
+	0x4f, 0x10, 0x00, 0x00, 0x5f, 0x00, 0x9f, 0xf0,
+	0x3f, 0x10, 0x03, 0xf0, 0x1e, 0x50, 0x03, 0xf0,
+	0x08, 0xd3, 0x16, 0xf0, 0x00, 0x8d, 0xfc, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x48 'H' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x05, 0xe0,
+	0x2f, 0x20, 0x05, 0xe0, 0x2f, 0x20, 0x05, 0xe0,
+	0x2f, 0x20, 0x05, 0xe0, 0x2f, 0xff, 0xff, 0xe0,
+	0x2f, 0x20, 0x05, 0xe0, 0x2f, 0x20, 0x05, 0xe0,
+	0x2f, 0x20, 0x05, 0xe0, 0x2f, 0x20, 0x05, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x49 'I' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x80,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x0b, 0xff, 0xff, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4a 'J' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x10,
+	0x00, 0x00, 0x3f, 0x10, 0x00, 0x00, 0x3f, 0x10,
+	0x00, 0x00, 0x3f, 0x10, 0x00, 0x00, 0x3f, 0x10,
+	0x00, 0x00, 0x3f, 0x10, 0x41, 0x00, 0x5e, 0x00,
+	0x5c, 0x31, 0xba, 0x00, 0x18, 0xde, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4b 'K' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x05, 0xe3,
+	0x2f, 0x20, 0x5e, 0x30, 0x2f, 0x25, 0xe3, 0x00,
+	0x2f, 0x8f, 0x40, 0x00, 0x2f, 0xed, 0x90, 0x00,
+	0x2f, 0x43, 0xf4, 0x00, 0x2f, 0x20, 0x7e, 0x10,
+	0x2f, 0x20, 0x0c, 0xb0, 0x2f, 0x20, 0x02, 0xe6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4c 'L' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
+	0x0a, 0xa0, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
+	0x0a, 0xa0, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
+	0x0a, 0xa0, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00,
+	0x0a, 0xa0, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xf4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4d 'M' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x70, 0x09, 0xf4,
+	0x7d, 0xc0, 0x0d, 0xe4, 0x7b, 0xc2, 0x59, 0xe4,
+	0x7b, 0x77, 0xa4, 0xe4, 0x7b, 0x2c, 0xd0, 0xe4,
+	0x7b, 0x0b, 0x80, 0xe4, 0x7b, 0x00, 0x00, 0xe4,
+	0x7b, 0x00, 0x00, 0xe4, 0x7b, 0x00, 0x00, 0xe4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4e 'N' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0xb0, 0x04, 0xe0,
+	0x2f, 0xe2, 0x04, 0xe0, 0x2f, 0x99, 0x04, 0xe0,
+	0x2f, 0x3e, 0x14, 0xe0, 0x2f, 0x29, 0x74, 0xe0,
+	0x2f, 0x23, 0xd5, 0xe0, 0x2f, 0x20, 0xc9, 0xe0,
+	0x2f, 0x20, 0x5e, 0xe0, 0x2f, 0x20, 0x0d, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x4f 'O' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xe9, 0x00,
+	0x0a, 0xc2, 0x3d, 0x70, 0x1f, 0x40, 0x07, 0xd0,
+	0x3f, 0x20, 0x04, 0xf0, 0x4f, 0x10, 0x04, 0xf1,
+	0x3f, 0x20, 0x04, 0xf0, 0x1f, 0x40, 0x07, 0xd0,
+	0x0a, 0xb1, 0x2d, 0x70, 0x01, 0xae, 0xe9, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x50 'P' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xeb, 0x20,
+	0x0b, 0x80, 0x1a, 0xd0, 0x0b, 0x80, 0x03, 0xf3,
+	0x0b, 0x80, 0x03, 0xf3, 0x0b, 0x80, 0x1a, 0xd0,
+	0x0b, 0xff, 0xeb, 0x30, 0x0b, 0x80, 0x00, 0x00,
+	0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x51 'Q' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xe9, 0x00,
+	0x0a, 0xc2, 0x3d, 0x70, 0x1f, 0x40, 0x07, 0xd0,
+	0x3f, 0x20, 0x04, 0xf0, 0x4f, 0x10, 0x04, 0xf1,
+	0x3f, 0x20, 0x04, 0xf0, 0x1f, 0x40, 0x07, 0xd0,
+	0x0a, 0xb1, 0x2d, 0x70, 0x01, 0xae, 0xfa, 0x00,
+	0x00, 0x00, 0x7e, 0x20, 0x00, 0x00, 0x0a, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x52 'R' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xd8, 0x00,
+	0x1f, 0x30, 0x3e, 0x80, 0x1f, 0x30, 0x09, 0xb0,
+	0x1f, 0x30, 0x2d, 0x70, 0x1f, 0xff, 0xf7, 0x00,
+	0x1f, 0x30, 0x7e, 0x10, 0x1f, 0x30, 0x0b, 0x90,
+	0x1f, 0x30, 0x04, 0xf2, 0x1f, 0x30, 0x00, 0xc9,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x53 'S' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xae, 0xd8, 0x10,
+	0x0c, 0x91, 0x16, 0x50, 0x1f, 0x20, 0x00, 0x00,
+	0x0d, 0xa3, 0x00, 0x00, 0x02, 0x9e, 0xe9, 0x10,
+	0x00, 0x00, 0x2b, 0xb0, 0x00, 0x00, 0x04, 0xe0,
+	0x0a, 0x31, 0x2b, 0xb0, 0x04, 0xbe, 0xea, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x54 'T' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xf8,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x55 'U' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x06, 0xd0,
+	0x1f, 0x30, 0x06, 0xd0, 0x1f, 0x30, 0x06, 0xd0,
+	0x1f, 0x30, 0x06, 0xd0, 0x1f, 0x30, 0x06, 0xd0,
+	0x1f, 0x30, 0x06, 0xd0, 0x0f, 0x30, 0x06, 0xd0,
+	0x0b, 0xa1, 0x2c, 0x90, 0x02, 0xae, 0xe9, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x56 'V' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xf5,
+	0x3f, 0x20, 0x04, 0xe1, 0x0d, 0x60, 0x08, 0xa0,
+	0x08, 0xa0, 0x0d, 0x60, 0x04, 0xe0, 0x2f, 0x10,
+	0x00, 0xe3, 0x6c, 0x00, 0x00, 0xa7, 0xa7, 0x00,
+	0x00, 0x5c, 0xe2, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x57 'W' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x7b,
+	0xc6, 0x00, 0x00, 0x99, 0x98, 0x00, 0x00, 0xb6,
+	0x7a, 0x0d, 0xa0, 0xd4, 0x4c, 0x2c, 0xd0, 0xf2,
+	0x2e, 0x68, 0xb4, 0xe0, 0x0e, 0xa4, 0x7a, 0xc0,
+	0x0c, 0xe1, 0x3e, 0xa0, 0x0a, 0xb0, 0x0e, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x58 'X' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x30, 0x03, 0xf3,
+	0x07, 0xc0, 0x0c, 0x70, 0x00, 0xc7, 0x7c, 0x00,
+	0x00, 0x3e, 0xe3, 0x00, 0x00, 0x1d, 0xd0, 0x00,
+	0x00, 0x8b, 0xc7, 0x00, 0x04, 0xe2, 0x3e, 0x20,
+	0x1d, 0x70, 0x09, 0xb0, 0x8c, 0x00, 0x01, 0xe6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x59 'Y' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x02, 0xe4,
+	0x0c, 0x70, 0x0a, 0xa0, 0x04, 0xe1, 0x4e, 0x20,
+	0x00, 0xaa, 0xc7, 0x00, 0x00, 0x1e, 0xc0, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5a 'Z' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xf4,
+	0x00, 0x00, 0x08, 0xd1, 0x00, 0x00, 0x3f, 0x30,
+	0x00, 0x01, 0xd7, 0x00, 0x00, 0x09, 0xc0, 0x00,
+	0x00, 0x4e, 0x20, 0x00, 0x01, 0xd6, 0x00, 0x00,
+	0x0a, 0xa0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5b '[' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x00,
+	0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00,
+	0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00,
+	0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00,
+	0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00,
+	0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00,
+	0x00, 0x1f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5c '\\' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00,
+	0x0a, 0x80, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x00, 0xc7, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00,
+	0x00, 0x0d, 0x50, 0x00, 0x00, 0x06, 0xc0, 0x00,
+	0x00, 0x01, 0xe4, 0x00, 0x00, 0x00, 0x7b, 0x00,
+	0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5d ']' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd0, 0x00,
+	0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd0, 0x00,
+	0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd0, 0x00,
+	0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd0, 0x00,
+	0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd0, 0x00,
+	0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd0, 0x00,
+	0x00, 0xcf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5e '^' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xc0, 0x00,
+	0x00, 0xba, 0xc8, 0x00, 0x07, 0xc0, 0x1d, 0x40,
+	0x3d, 0x10, 0x03, 0xd1, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x5f '_' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	/* 0x60 '`' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xa7, 0x00, 0x00, 0x00, 0x0a, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x61 'a' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xae, 0xe8, 0x00,
+	0x08, 0x51, 0x2d, 0x60, 0x00, 0x00, 0x07, 0xa0,
+	0x04, 0xce, 0xff, 0xb0, 0x1f, 0x61, 0x08, 0xb0,
+	0x1f, 0x40, 0x4d, 0xb0, 0x06, 0xdf, 0xb8, 0xb0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x62 'b' */
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00,
+	0x0c, 0x60, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00,
+	0x0c, 0x60, 0x00, 0x00, 0x0c, 0x8d, 0xea, 0x10,
+	0x0c, 0xd3, 0x1b, 0x90, 0x0c, 0x80, 0x05, 0xe0,
+	0x0c, 0x60, 0x03, 0xf0, 0x0c, 0x80, 0x04, 0xe0,
+	0x0c, 0xd3, 0x1b, 0x90, 0x0c, 0x8d, 0xea, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x63 'c' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xec, 0x30,
+	0x03, 0xf6, 0x13, 0x70, 0x09, 0xa0, 0x00, 0x00,
+	0x0b, 0x80, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00,
+	0x03, 0xf5, 0x12, 0x70, 0x00, 0x4c, 0xec, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x64 'd' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90,
+	0x00, 0x00, 0x08, 0x90, 0x00, 0x00, 0x08, 0x90,
+	0x00, 0x00, 0x08, 0x90, 0x02, 0xbe, 0xca, 0x90,
+	0x0c, 0x91, 0x4f, 0x90, 0x1f, 0x20, 0x0a, 0x90,
+	0x3f, 0x10, 0x09, 0x90, 0x1f, 0x20, 0x0a, 0x90,
+	0x0b, 0x91, 0x4f, 0x90, 0x02, 0xbe, 0xb9, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x65 'e' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x9d, 0xe9, 0x10,
+	0x0a, 0xb2, 0x1a, 0x90, 0x1f, 0x30, 0x03, 0xe0,
+	0x3f, 0xff, 0xff, 0xf1, 0x1f, 0x10, 0x00, 0x00,
+	0x0a, 0xa2, 0x15, 0x90, 0x01, 0x8d, 0xea, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x66 'f' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xb0,
+	0x00, 0x09, 0x90, 0x00, 0x00, 0x0c, 0x50, 0x00,
+	0x00, 0x0d, 0x40, 0x00, 0x0c, 0xff, 0xff, 0xb0,
+	0x00, 0x0d, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00,
+	0x00, 0x0d, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00,
+	0x00, 0x0d, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x67 'g' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xbe, 0xba, 0x90,
+	0x0b, 0xa1, 0x4e, 0x90, 0x1f, 0x20, 0x0a, 0x90,
+	0x3f, 0x10, 0x09, 0x90, 0x1f, 0x20, 0x0a, 0x90,
+	0x0b, 0xa1, 0x4e, 0x90, 0x02, 0xbe, 0xba, 0x90,
+	0x00, 0x00, 0x0a, 0x70, 0x05, 0x61, 0x3e, 0x30,
+	0x01, 0x9e, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x68 'h' */
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00,
+	0x0c, 0x60, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00,
+	0x0c, 0x60, 0x00, 0x00, 0x0c, 0x8c, 0xeb, 0x10,
+	0x0c, 0xd2, 0x1c, 0x70, 0x0c, 0x70, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0c, 0x60, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0c, 0x60, 0x08, 0xa0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x69 'i' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x90, 0x00,
+	0x00, 0x08, 0x90, 0x00, 0x00, 0x08, 0x90, 0x00,
+	0x00, 0x08, 0x90, 0x00, 0x00, 0x08, 0x90, 0x00,
+	0x00, 0x08, 0x90, 0x00, 0x0d, 0xff, 0xff, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6a 'j' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00,
+	0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00,
+	0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00,
+	0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00,
+	0x00, 0x03, 0xe0, 0x00, 0x00, 0x08, 0xc0, 0x00,
+	0x0c, 0xfd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6b 'k' */
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00,
+	0x08, 0xb0, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00,
+	0x08, 0xb0, 0x00, 0x00, 0x08, 0xb0, 0x1b, 0xa0,
+	0x08, 0xb1, 0xb9, 0x00, 0x08, 0xcc, 0xa0, 0x00,
+	0x08, 0xfa, 0xe2, 0x00, 0x08, 0xb0, 0x9b, 0x00,
+	0x08, 0xb0, 0x1d, 0x80, 0x08, 0xb0, 0x03, 0xe4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6c 'l' */
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x10, 0x00,
+	0x00, 0x2f, 0x10, 0x00, 0x00, 0x2f, 0x10, 0x00,
+	0x00, 0x2f, 0x10, 0x00, 0x00, 0x2f, 0x10, 0x00,
+	0x00, 0x2f, 0x10, 0x00, 0x00, 0x2f, 0x10, 0x00,
+	0x00, 0x2f, 0x10, 0x00, 0x00, 0x1f, 0x10, 0x00,
+	0x00, 0x0d, 0x60, 0x00, 0x00, 0x04, 0xdf, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6d 'm' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5d, 0xdd, 0x7e, 0x90,
+	0x5e, 0x1c, 0xa1, 0xf1, 0x5c, 0x09, 0x70, 0xd3,
+	0x5b, 0x09, 0x70, 0xd3, 0x5b, 0x09, 0x70, 0xd3,
+	0x5b, 0x09, 0x70, 0xd3, 0x5b, 0x09, 0x70, 0xd3,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6e 'n' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x8c, 0xeb, 0x10,
+	0x0c, 0xd2, 0x1c, 0x70, 0x0c, 0x70, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0c, 0x60, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0c, 0x60, 0x08, 0xa0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x6f 'o' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xd8, 0x00,
+	0x0a, 0xb1, 0x2d, 0x70, 0x0f, 0x40, 0x06, 0xc0,
+	0x1f, 0x20, 0x05, 0xe0, 0x0f, 0x40, 0x06, 0xc0,
+	0x0a, 0xb1, 0x2d, 0x70, 0x01, 0xae, 0xe9, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x70 'p' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x9d, 0xea, 0x10,
+	0x0c, 0xd3, 0x1c, 0x90, 0x0c, 0x80, 0x05, 0xe0,
+	0x0c, 0x60, 0x03, 0xf0, 0x0c, 0x80, 0x05, 0xe0,
+	0x0c, 0xd2, 0x1c, 0x90, 0x0c, 0x8d, 0xea, 0x10,
+	0x0c, 0x60, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00,
+	0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x71 'q' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xc9, 0xb0,
+	0x0a, 0xb1, 0x3e, 0xb0, 0x0f, 0x30, 0x09, 0xb0,
+	0x1f, 0x20, 0x08, 0xb0, 0x0f, 0x30, 0x09, 0xb0,
+	0x0a, 0xb1, 0x3e, 0xb0, 0x01, 0xbe, 0xc9, 0xb0,
+	0x00, 0x00, 0x07, 0xb0, 0x00, 0x00, 0x07, 0xb0,
+	0x00, 0x00, 0x07, 0xb0, 0x00, 0x00, 0x00, 0x00,
+	/* 0x72 'r' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbf, 0xf5,
+	0x00, 0xbe, 0x51, 0x00, 0x00, 0xb9, 0x00, 0x00,
+	0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00,
+	0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x73 's' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xd7, 0x00,
+	0x08, 0xc1, 0x18, 0x20, 0x08, 0xb1, 0x00, 0x00,
+	0x01, 0x8c, 0xc8, 0x00, 0x00, 0x00, 0x1c, 0x60,
+	0x08, 0x51, 0x2d, 0x60, 0x02, 0xae, 0xe9, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x74 't' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00,
+	0x00, 0x4d, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x80,
+	0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00,
+	0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00,
+	0x00, 0x2f, 0x30, 0x00, 0x00, 0x08, 0xef, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x75 'u' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0c, 0x60, 0x08, 0xa0,
+	0x0c, 0x60, 0x08, 0xa0, 0x0b, 0x70, 0x09, 0xa0,
+	0x09, 0xb1, 0x3e, 0xa0, 0x02, 0xcf, 0xb9, 0xa0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x76 'v' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3e, 0x10, 0x03, 0xe1,
+	0x0c, 0x60, 0x08, 0xa0, 0x07, 0xb0, 0x0d, 0x40,
+	0x02, 0xf1, 0x4e, 0x00, 0x00, 0xb6, 0x99, 0x00,
+	0x00, 0x6c, 0xe3, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x77 'w' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x7b,
+	0xa7, 0x00, 0x00, 0xa7, 0x6b, 0x0b, 0x80, 0xd3,
+	0x3e, 0x1c, 0xc1, 0xf0, 0x0e, 0x78, 0xa6, 0xb0,
+	0x0b, 0xe3, 0x6d, 0x80, 0x07, 0xe0, 0x2f, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x78 'x' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1d, 0x60, 0x09, 0xb0,
+	0x03, 0xe3, 0x5d, 0x10, 0x00, 0x5d, 0xe3, 0x00,
+	0x00, 0x0d, 0xb0, 0x00, 0x00, 0x9a, 0xc6, 0x00,
+	0x06, 0xd1, 0x2e, 0x30, 0x3e, 0x30, 0x06, 0xd1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x79 'y' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x10, 0x02, 0xf2,
+	0x0c, 0x70, 0x07, 0xb0, 0x06, 0xd0, 0x0d, 0x50,
+	0x01, 0xe4, 0x4e, 0x10, 0x00, 0x99, 0xa9, 0x00,
+	0x00, 0x3e, 0xe3, 0x00, 0x00, 0x0d, 0xd0, 0x00,
+	0x00, 0x0b, 0x70, 0x00, 0x00, 0x4f, 0x20, 0x00,
+	0x0c, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x7a 'z' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x90,
+	0x00, 0x00, 0x2d, 0x40, 0x00, 0x01, 0xc6, 0x00,
+	0x00, 0x0a, 0x90, 0x00, 0x00, 0x8b, 0x00, 0x00,
+	0x05, 0xd1, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x7b '{' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x60,
+	0x00, 0x08, 0xb1, 0x00, 0x00, 0x0a, 0x80, 0x00,
+	0x00, 0x0a, 0x80, 0x00, 0x00, 0x2d, 0x60, 0x00,
+	0x09, 0xfc, 0x00, 0x00, 0x00, 0x3e, 0x50, 0x00,
+	0x00, 0x0b, 0x80, 0x00, 0x00, 0x0a, 0x80, 0x00,
+	0x00, 0x09, 0x80, 0x00, 0x00, 0x08, 0xb1, 0x00,
+	0x00, 0x02, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x7c '|' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x7d '}' */
+	0x00, 0x00, 0x00, 0x00, 0x09, 0xeb, 0x10, 0x00,
+	0x00, 0x1d, 0x50, 0x00, 0x00, 0x0b, 0x70, 0x00,
+	0x00, 0x0b, 0x70, 0x00, 0x00, 0x09, 0xb1, 0x00,
+	0x00, 0x02, 0xdf, 0x60, 0x00, 0x08, 0xd2, 0x00,
+	0x00, 0x0a, 0x80, 0x00, 0x00, 0x0b, 0x70, 0x00,
+	0x00, 0x0b, 0x60, 0x00, 0x00, 0x2d, 0x50, 0x00,
+	0x09, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0x7e '~' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0xeb, 0x41, 0x64,
+	0x54, 0x14, 0xbe, 0x91, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const struct ili9163c_font ili9163c_font_mono_8x16_aa = {
+	.glyphs = ili9163c_font_mono_8x16_aa_glyphs,
+	.width = 8,
+	.height = 16,
+	.bpp = 4,
+	.first = 0x20,
+	.last = 0x7e,
+};
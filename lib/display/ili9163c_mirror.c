@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/display/ili9163c_area.h>
+#include <zephyr/display/ili9163c_mirror.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/sys/byteorder.h>
+
+#ifdef CONFIG_SERIAL
+#include <zephyr/drivers/uart.h>
+#endif
+
+#ifdef CONFIG_FILE_SYSTEM
+#include <zephyr/fs/fs.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ili9163c_mirror, CONFIG_DISPLAY_LOG_LEVEL);
+
+struct ili9163c_mirror {
+	const struct device *dev;
+	ili9163c_mirror_sink_t sink;
+	void *user_data;
+	uint16_t width;
+	uint16_t height;
+	/* Protects the shadow, the pending areas and the statistics. */
+	struct k_spinlock lock;
+	struct ili9163c_area dirty[CONFIG_ILI9163C_MIRROR_DIRTY_RECTS];
+	uint8_t dirty_count;
+	bool header_pending;
+	bool reshaped;
+	bool stopping;
+	uint32_t seq;
+	size_t len;
+	struct ili9163c_mirror_stats stats;
+};
+
+static struct ili9163c_mirror ili9163c_mirror;
+static uint16_t ili9163c_mirror_shadow[CONFIG_ILI9163C_MIRROR_MAX_PIXELS];
+static uint8_t ili9163c_mirror_buf[CONFIG_ILI9163C_MIRROR_BUFFER_SIZE];
+static bool ili9163c_mirror_running;
+
+K_SEM_DEFINE(ili9163c_mirror_sem, 0, 1);
+K_MUTEX_DEFINE(ili9163c_mirror_lock);
+
+static K_THREAD_STACK_DEFINE(ili9163c_mirror_stack, CONFIG_ILI9163C_MIRROR_STACK_SIZE);
+static struct k_thread ili9163c_mirror_thread;
+
+static void ili9163c_mirror_set_full(struct ili9163c_mirror *mirror)
+{
+	mirror->dirty[0] = (struct ili9163c_area){0U, 0U, mirror->width, mirror->height};
+	mirror->dirty_count = 1U;
+	mirror->header_pending = true;
+}
+
+static void ili9163c_mirror_add_dirty(struct ili9163c_mirror *mirror,
+				      const struct ili9163c_area *area)
+{
+	if (ili9163c_area_add(mirror->dirty, &mirror->dirty_count, ARRAY_SIZE(mirror->dirty),
+			      area)) {
+		mirror->stats.coalesced++;
+	}
+}
+
+static void ili9163c_mirror_hook(const struct device *dev, uint16_t x, uint16_t y,
+				 const struct display_buffer_descriptor *desc, const void *buf,
+				 enum display_pixel_format pixel_format, void *user_data)
+{
+	struct ili9163c_mirror *mirror = user_data;
+	struct ili9163c_area changed = {UINT16_MAX, UINT16_MAX, 0U, 0U};
+	size_t bpp = (pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+	uint32_t start = k_cycle_get_32();
+	k_spinlock_key_t key;
+	const uint8_t *src;
+	uint16_t *dst;
+	uint16_t pixel;
+	struct display_capabilities capabilities;
+	uint16_t w = 0U;
+	uint16_t h = 0U;
+
+	/* Only this hook changes the shape, and the driver lock serializes its calls. */
+	display_get_capabilities(dev, &capabilities);
+	if ((capabilities.x_resolution != mirror->width) ||
+	    (capabilities.y_resolution != mirror->height)) {
+		/* The orientation changed: the shadow content no longer matches the screen. */
+		key = k_spin_lock(&mirror->lock);
+		memset(ili9163c_mirror_shadow, 0,
+		       (size_t)mirror->width * mirror->height * sizeof(ili9163c_mirror_shadow[0]));
+		mirror->width = capabilities.x_resolution;
+		mirror->height = capabilities.y_resolution;
+		mirror->reshaped = true;
+		ili9163c_mirror_set_full(mirror);
+		k_spin_unlock(&mirror->lock, key);
+
+		k_sem_give(&ili9163c_mirror_sem);
+	}
+
+	if ((x < mirror->width) && (y < mirror->height)) {
+		w = MIN(desc->width, mirror->width - x);
+		h = MIN(desc->height, mirror->height - y);
+	}
+
+	for (uint16_t row = 0U; row < h; row++) {
+		src = (const uint8_t *)buf + (size_t)row * desc->pitch * bpp;
+		dst = &ili9163c_mirror_shadow[(y + row) * mirror->width + x];
+
+		/* One row at a time, so the mirror thread never sees a partially updated row. */
+		key = k_spin_lock(&mirror->lock);
+
+		for (uint16_t col = 0U; col < w; col++, src += bpp) {
+			if (bpp == 2U) {
+				pixel = sys_get_be16(src);
+			} else {
+				pixel = ((src[0] & 0xF8U) << 8) | ((src[1] & 0xFCU) << 3) |
+					(src[2] >> 3);
+			}
+
+			if (dst[col] != pixel) {
+				dst[col] = pixel;
+				changed.x0 = MIN(changed.x0, x + col);
+				changed.x1 = MAX(changed.x1, x + col + 1U);
+				changed.y0 = MIN(changed.y0, y + row);
+				changed.y1 = y + row + 1U;
+			}
+		}
+
+		k_spin_unlock(&mirror->lock, key);
+	}
+
+	key = k_spin_lock(&mirror->lock);
+
+	mirror->stats.writes++;
+	if (changed.x1 > 0U) {
+		mirror->stats.changed++;
+		ili9163c_mirror_add_dirty(mirror, &changed);
+	}
+
+	mirror->stats.max_hook_cycles = MAX(mirror->stats.max_hook_cycles,
+					    k_cycle_get_32() - start);
+
+	k_spin_unlock(&mirror->lock, key);
+
+	if (changed.x1 > 0U) {
+		k_sem_give(&ili9163c_mirror_sem);
+	}
+}
+
+static int ili9163c_mirror_flush(struct ili9163c_mirror *mirror)
+{
+	k_spinlock_key_t key;
+	int r;
+
+	if (mirror->len == 0U) {
+		return 0;
+	}
+
+	r = mirror->sink(ili9163c_mirror_buf, mirror->len, mirror->user_data);
+	if (r == 0) {
+		key = k_spin_lock(&mirror->lock);
+		mirror->stats.bytes += mirror->len;
+		k_spin_unlock(&mirror->lock, key);
+	}
+
+	mirror->len = 0U;
+
+	return r;
+}
+
+/* Make room for len bytes in the output buffer, sending its content if needed. */
+static int ili9163c_mirror_reserve(struct ili9163c_mirror *mirror, size_t len)
+{
+	if (mirror->len + len > sizeof(ili9163c_mirror_buf)) {
+		return ili9163c_mirror_flush(mirror);
+	}
+
+	return 0;
+}
+
+static void ili9163c_mirror_put_record(struct ili9163c_mirror *mirror, uint8_t type)
+{
+	ili9163c_mirror_buf[mirror->len++] = ILI9163C_MIRROR_SYNC;
+	ili9163c_mirror_buf[mirror->len++] = type;
+}
+
+static void ili9163c_mirror_put_le16(struct ili9163c_mirror *mirror, uint16_t value)
+{
+	sys_put_le16(value, &ili9163c_mirror_buf[mirror->len]);
+	mirror->len += 2U;
+}
+
+static void ili9163c_mirror_put_le32(struct ili9163c_mirror *mirror, uint32_t value)
+{
+	sys_put_le32(value, &ili9163c_mirror_buf[mirror->len]);
+	mirror->len += 4U;
+}
+
+/* Worst case size of an encoded row: literal packets of 128 pixels. */
+static size_t ili9163c_mirror_row_max(uint16_t width)
+{
+	return width * 2U + DIV_ROUND_UP(width, 128U);
+}
+
+static void ili9163c_mirror_encode_row(struct ili9163c_mirror *mirror, const uint16_t *row,
+				       uint16_t width)
+{
+	uint8_t *out = &ili9163c_mirror_buf[mirror->len];
+	uint16_t i = 0U;
+	uint16_t n;
+
+	while (i < width) {
+		n = 1U;
+		while ((i + n < width) && (n < 128U) && (row[i + n] == row[i])) {
+			n++;
+		}
+
+		if (n > 1U) {
+			*out++ = 0x80U | (n - 1U);
+			sys_put_le16(row[i], out);
+			out += 2;
+			i += n;
+			continue;
+		}
+
+		/* Literal pixels, up to the start of the next run. */
+		while ((i + n < width) && (n < 128U) &&
+		       !((i + n + 1U < width) && (row[i + n] == row[i + n + 1U]))) {
+			n++;
+		}
+
+		*out++ = n - 1U;
+		for (; n > 0U; n--, i++) {
+			sys_put_le16(row[i], out);
+			out += 2;
+		}
+	}
+
+	mirror->len = out - ili9163c_mirror_buf;
+}
+
+static int ili9163c_mirror_send_header(struct ili9163c_mirror *mirror)
+{
+	k_spinlock_key_t key;
+	uint16_t width;
+	uint16_t height;
+	int r;
+
+	r = ili9163c_mirror_reserve(mirror, 8U);
+	if (r < 0) {
+		return r;
+	}
+
+	key = k_spin_lock(&mirror->lock);
+	width = mirror->width;
+	height = mirror->height;
+	k_spin_unlock(&mirror->lock, key);
+
+	ili9163c_mirror_put_record(mirror, ILI9163C_MIRROR_HEADER);
+	ili9163c_mirror_buf[mirror->len++] = ILI9163C_MIRROR_VERSION;
+	ili9163c_mirror_buf[mirror->len++] = 0U;
+	ili9163c_mirror_put_le16(mirror, width);
+	ili9163c_mirror_put_le16(mirror, height);
+
+	return 0;
+}
+
+static int ili9163c_mirror_send_rect(struct ili9163c_mirror *mirror,
+				     const struct ili9163c_area *area)
+{
+	uint16_t width = area->x1 - area->x0;
+	const uint16_t *row;
+	k_spinlock_key_t key;
+	int r;
+
+	r = ili9163c_mirror_reserve(mirror, 10U);
+	if (r < 0) {
+		return r;
+	}
+
+	ili9163c_mirror_put_record(mirror, ILI9163C_MIRROR_RECT);
+	ili9163c_mirror_put_le16(mirror, area->x0);
+	ili9163c_mirror_put_le16(mirror, area->y0);
+	ili9163c_mirror_put_le16(mirror, width);
+	ili9163c_mirror_put_le16(mirror, area->y1 - area->y0);
+
+	for (uint16_t y = area->y0; y < area->y1; y++) {
+		r = ili9163c_mirror_reserve(mirror, ili9163c_mirror_row_max(width));
+		if (r < 0) {
+			return r;
+		}
+
+		key = k_spin_lock(&mirror->lock);
+
+		/* The area was taken with the previous shape, the whole screen is queued. */
+		if (mirror->reshaped) {
+			k_spin_unlock(&mirror->lock, key);
+			return -ECANCELED;
+		}
+
+		row = &ili9163c_mirror_shadow[y * mirror->width + area->x0];
+		ili9163c_mirror_encode_row(mirror, row, width);
+
+		k_spin_unlock(&mirror->lock, key);
+	}
+
+	return 0;
+}
+
+static int ili9163c_mirror_send_frame(struct ili9163c_mirror *mirror)
+{
+	int r;
+
+	r = ili9163c_mirror_reserve(mirror, 10U);
+	if (r < 0) {
+		return r;
+	}
+
+	ili9163c_mirror_put_record(mirror, ILI9163C_MIRROR_FRAME);
+	ili9163c_mirror_put_le32(mirror, mirror->seq++);
+	ili9163c_mirror_put_le32(mirror, k_uptime_get_32());
+
+	return ili9163c_mirror_flush(mirror);
+}
+
+static void ili9163c_mirror_run(void *p1, void *p2, void *p3)
+{
+	struct ili9163c_mirror *mirror = p1;
+	struct ili9163c_area dirty[CONFIG_ILI9163C_MIRROR_DIRTY_RECTS];
+	k_spinlock_key_t key;
+	uint64_t raw_bytes;
+	uint8_t count;
+	bool header;
+	bool stopping;
+	int r;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	do {
+		k_sem_take(&ili9163c_mirror_sem, K_FOREVER);
+
+		key = k_spin_lock(&mirror->lock);
+		count = mirror->dirty_count;
+		memcpy(dirty, mirror->dirty, count * sizeof(dirty[0]));
+		mirror->dirty_count = 0U;
+		header = mirror->header_pending;
+		mirror->header_pending = false;
+		mirror->reshaped = false;
+		stopping = mirror->stopping;
+		k_spin_unlock(&mirror->lock, key);
+
+		if ((count == 0U) && !header) {
+			continue;
+		}
+
+		r = header ? ili9163c_mirror_send_header(mirror) : 0;
+		raw_bytes = 0U;
+		for (uint8_t i = 0U; (r == 0) && (i < count); i++) {
+			r = ili9163c_mirror_send_rect(mirror, &dirty[i]);
+			raw_bytes += ili9163c_area_size(&dirty[i]) * 2U;
+		}
+
+		if (r == 0) {
+			r = ili9163c_mirror_send_frame(mirror);
+		}
+
+		key = k_spin_lock(&mirror->lock);
+		if (r == -ECANCELED) {
+			/* The decoder drops the cut record and waits for the next header. */
+			mirror->len = 0U;
+		} else if (r < 0) {
+			/* The stream may be cut in the middle of a record: start over. */
+			mirror->len = 0U;
+			mirror->stats.sink_errors++;
+			ili9163c_mirror_set_full(mirror);
+		} else {
+			mirror->stats.updates++;
+			mirror->stats.rects += count;
+			mirror->stats.raw_bytes += raw_bytes;
+		}
+		k_spin_unlock(&mirror->lock, key);
+
+		if ((r < 0) && (r != -ECANCELED)) {
+			LOG_WRN("Sink failed (%d), resending the screen", r);
+			k_sem_give(&ili9163c_mirror_sem);
+		}
+
+		/* Changes made meanwhile are merged and sent with the next update. */
+		if (!stopping) {
+			k_sleep(K_MSEC(CONFIG_ILI9163C_MIRROR_MIN_PERIOD_MS));
+		}
+	} while (!stopping);
+}
+
+int ili9163c_mirror_start(const struct device *dev, ili9163c_mirror_sink_t sink, void *user_data)
+{
+	struct ili9163c_mirror *mirror = &ili9163c_mirror;
+	struct display_capabilities capabilities;
+	int r = 0;
+
+	k_mutex_lock(&ili9163c_mirror_lock, K_FOREVER);
+
+	if (ili9163c_mirror_running) {
+		r = -EBUSY;
+		goto out;
+	}
+
+	/* Rows are checked in both orientations, which swap the resolutions. */
+	display_get_capabilities(dev, &capabilities);
+	if ((capabilities.x_resolution * capabilities.y_resolution >
+	     CONFIG_ILI9163C_MIRROR_MAX_PIXELS) ||
+	    (ili9163c_mirror_row_max(MAX(capabilities.x_resolution, capabilities.y_resolution)) >
+	     CONFIG_ILI9163C_MIRROR_BUFFER_SIZE)) {
+		LOG_ERR("Screen too large to be mirrored");
+		r = -ENOMEM;
+		goto out;
+	}
+
+	memset(mirror, 0, sizeof(*mirror));
+	memset(ili9163c_mirror_shadow, 0, sizeof(ili9163c_mirror_shadow));
+	mirror->dev = dev;
+	mirror->sink = sink;
+	mirror->user_data = user_data;
+	mirror->width = capabilities.x_resolution;
+	mirror->height = capabilities.y_resolution;
+	mirror->header_pending = true;
+
+	k_sem_reset(&ili9163c_mirror_sem);
+	k_thread_create(&ili9163c_mirror_thread, ili9163c_mirror_stack,
+			K_THREAD_STACK_SIZEOF(ili9163c_mirror_stack), ili9163c_mirror_run, mirror,
+			NULL, NULL, CONFIG_ILI9163C_MIRROR_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&ili9163c_mirror_thread, "ili9163c_mirror");
+
+	ili9163c_set_write_hook(dev, ili9163c_mirror_hook, mirror);
+	k_sem_give(&ili9163c_mirror_sem);
+
+	ili9163c_mirror_running = true;
+
+out:
+	k_mutex_unlock(&ili9163c_mirror_lock);
+
+	return r;
+}
+
+int ili9163c_mirror_stop(void)
+{
+	struct ili9163c_mirror *mirror = &ili9163c_mirror;
+	k_spinlock_key_t key;
+
+	k_mutex_lock(&ili9163c_mirror_lock, K_FOREVER);
+
+	if (!ili9163c_mirror_running) {
+		k_mutex_unlock(&ili9163c_mirror_lock);
+		return -EALREADY;
+	}
+
+	/* Returns once a running hook is done, since both take the driver lock. */
+	ili9163c_set_write_hook(mirror->dev, NULL, NULL);
+
+	key = k_spin_lock(&mirror->lock);
+	mirror->stopping = true;
+	k_spin_unlock(&mirror->lock, key);
+
+	k_sem_give(&ili9163c_mirror_sem);
+	k_thread_join(&ili9163c_mirror_thread, K_FOREVER);
+
+	ili9163c_mirror_running = false;
+
+	k_mutex_unlock(&ili9163c_mirror_lock);
+
+	return 0;
+}
+
+void ili9163c_mirror_snapshot(void)
+{
+	struct ili9163c_mirror *mirror = &ili9163c_mirror;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&mirror->lock);
+	if (mirror->width > 0U) {
+		ili9163c_mirror_set_full(mirror);
+	}
+	k_spin_unlock(&mirror->lock, key);
+
+	k_sem_give(&ili9163c_mirror_sem);
+}
+
+void ili9163c_mirror_get_stats(struct ili9163c_mirror_stats *stats)
+{
+	struct ili9163c_mirror *mirror = &ili9163c_mirror;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&mirror->lock);
+	*stats = mirror->stats;
+	k_spin_unlock(&mirror->lock, key);
+}
+
+#ifdef CONFIG_SERIAL
+int ili9163c_mirror_uart_sink(const uint8_t *data, size_t len, void *user_data)
+{
+	const struct device *uart = user_data;
+
+	for (size_t i = 0U; i < len; i++) {
+		uart_poll_out(uart, data[i]);
+	}
+
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_FILE_SYSTEM
+int ili9163c_mirror_fs_sink(const uint8_t *data, size_t len, void *user_data)
+{
+	struct fs_file_t *file = user_data;
+	ssize_t r;
+
+	r = fs_write(file, data, len);
+	if (r < 0) {
+		return (int)r;
+	}
+
+	return ((size_t)r == len) ? 0 : -ENOSPC;
+}
+#endif
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/display/ili9163c_player.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/fs/fs.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ili9163c_player, CONFIG_DISPLAY_LOG_LEVEL);
+
+/** Chunk of rows read from the file, rows is 0 at the end of the stream. */
+struct ili9163c_player_chunk {
+	uint8_t buf;
+	uint32_t frame;
+	uint16_t row;
+	uint16_t rows;
+};
+
+struct ili9163c_player {
+	const struct ili9163c_player_config *config;
+	struct fs_file_t file;
+	uint32_t frame_count;
+	size_t row_size;
+	uint16_t chunk_rows;
+	int64_t start;
+	int64_t period;
+	int read_err;
+	uint32_t dropped;
+	uint64_t read_cycles;
+};
+
+static uint8_t ili9163c_player_bufs[CONFIG_ILI9163C_PLAYER_BUFFERS]
+				   [CONFIG_ILI9163C_PLAYER_BUFFER_SIZE] __aligned(4);
+
+K_MSGQ_DEFINE(ili9163c_player_free, sizeof(uint8_t), CONFIG_ILI9163C_PLAYER_BUFFERS, 1);
+K_MSGQ_DEFINE(ili9163c_player_ready, sizeof(struct ili9163c_player_chunk),
+	      CONFIG_ILI9163C_PLAYER_BUFFERS + 1, 4);
+K_MUTEX_DEFINE(ili9163c_player_lock);
+
+static K_THREAD_STACK_DEFINE(ili9163c_player_stack, CONFIG_ILI9163C_PLAYER_READER_STACK_SIZE);
+static struct k_thread ili9163c_player_thread;
+static atomic_t ili9163c_player_stopping;
+
+static int64_t ili9163c_player_deadline(const struct ili9163c_player *player, uint32_t frame)
+{
+	return player->start + (int64_t)frame * player->period;
+}
+
+static int ili9163c_player_read_frame(struct ili9163c_player *player, uint32_t frame)
+{
+	const struct ili9163c_player_config *config = player->config;
+	struct ili9163c_player_chunk chunk = {.frame = frame};
+	uint32_t start;
+	ssize_t len;
+	size_t size;
+
+	for (chunk.row = 0U; chunk.row < config->height; chunk.row += chunk.rows) {
+		chunk.rows = MIN(player->chunk_rows, config->height - chunk.row);
+		size = chunk.rows * player->row_size;
+
+		k_msgq_get(&ili9163c_player_free, &chunk.buf, K_FOREVER);
+
+		start = k_cycle_get_32();
+		len = fs_read(&player->file, ili9163c_player_bufs[chunk.buf], size);
+		player->read_cycles += k_cycle_get_32() - start;
+
+		if ((len < 0) || ((size_t)len != size)) {
+			k_msgq_put(&ili9163c_player_free, &chunk.buf, K_NO_WAIT);
+			return (len < 0) ? (int)len : -EIO;
+		}
+
+		k_msgq_put(&ili9163c_player_ready, &chunk, K_FOREVER);
+	}
+
+	return 0;
+}
+
+static void ili9163c_player_reader(void *p1, void *p2, void *p3)
+{
+	struct ili9163c_player *player = p1;
+	const struct ili9163c_player_config *config = player->config;
+	const struct ili9163c_player_chunk end = {0};
+	size_t frame_size = config->height * player->row_size;
+	uint32_t frame_pos = 0U;
+	int r = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t frame = 0U; (config->max_frames == 0U) || (frame < config->max_frames);
+	     frame++) {
+		if (atomic_get(&ili9163c_player_stopping) != 0) {
+			break;
+		}
+
+		if (frame_pos == player->frame_count) {
+			if (!config->loop) {
+				break;
+			}
+
+			frame_pos = 0U;
+			r = fs_seek(&player->file, 0, FS_SEEK_SET);
+		}
+
+		/* Once past the deadline of the next frame, this one can no longer be shown. */
+		if ((r == 0) && (k_uptime_ticks() > ili9163c_player_deadline(player, frame + 1U))) {
+			player->dropped++;
+			frame_pos++;
+			r = fs_seek(&player->file, frame_size, FS_SEEK_CUR);
+		} else if (r == 0) {
+			r = ili9163c_player_read_frame(player, frame);
+			frame_pos++;
+		}
+
+		if (r < 0) {
+			LOG_ERR("Could not read frame %u (%d)", frame, r);
+			player->read_err = r;
+			break;
+		}
+	}
+
+	k_msgq_put(&ili9163c_player_ready, &end, K_FOREVER);
+}
+
+static int ili9163c_player_open(struct ili9163c_player *player)
+{
+	const struct ili9163c_player_config *config = player->config;
+	struct display_capabilities capabilities;
+	struct fs_dirent entry;
+	size_t frame_size;
+	int r;
+
+	if ((config->width == 0U) || (config->height == 0U) || (config->fps == 0U)) {
+		return -EINVAL;
+	}
+
+	display_get_capabilities(config->display, &capabilities);
+	if ((config->x + config->width > capabilities.x_resolution) ||
+	    (config->y + config->height > capabilities.y_resolution)) {
+		return -EINVAL;
+	}
+
+	switch (capabilities.current_pixel_format) {
+	case PIXEL_FORMAT_RGB_565:
+		player->row_size = config->width * 2U;
+		break;
+	case PIXEL_FORMAT_RGB_888:
+		player->row_size = config->width * 3U;
+		break;
+	default:
+		LOG_ERR("Unsupported pixel format");
+		return -ENOTSUP;
+	}
+
+	player->chunk_rows = MIN(CONFIG_ILI9163C_PLAYER_BUFFER_SIZE / player->row_size,
+				 config->height);
+	if (player->chunk_rows == 0U) {
+		LOG_ERR("Buffers are smaller than a row");
+		return -EINVAL;
+	}
+
+	r = fs_stat(config->path, &entry);
+	if (r < 0) {
+		return r;
+	}
+
+	frame_size = config->height * player->row_size;
+	player->frame_count = entry.size / frame_size;
+	if ((player->frame_count == 0U) || ((entry.size % frame_size) != 0U)) {
+		LOG_ERR("%s is not made of %ux%u frames", config->path, config->width,
+			config->height);
+		return -EINVAL;
+	}
+
+	fs_file_t_init(&player->file);
+
+	return fs_open(&player->file, config->path, FS_O_READ);
+}
+
+int ili9163c_player_play(const struct ili9163c_player_config *config,
+			 struct ili9163c_player_stats *stats)
+{
+	struct ili9163c_player player = {.config = config};
+	struct ili9163c_player_stats result = {0};
+	struct ili9163c_player_chunk chunk;
+	struct display_buffer_descriptor desc;
+	uint32_t start;
+	int r;
+
+	if (k_mutex_lock(&ili9163c_player_lock, K_NO_WAIT) < 0) {
+		return -EBUSY;
+	}
+
+	r = ili9163c_player_open(&player);
+	if (r < 0) {
+		k_mutex_unlock(&ili9163c_player_lock);
+		return r;
+	}
+
+	k_msgq_purge(&ili9163c_player_free);
+	k_msgq_purge(&ili9163c_player_ready);
+	for (uint8_t i = 0U; i < CONFIG_ILI9163C_PLAYER_BUFFERS; i++) {
+		k_msgq_put(&ili9163c_player_free, &i, K_NO_WAIT);
+	}
+
+	atomic_set(&ili9163c_player_stopping, 0);
+
+	player.period = k_us_to_ticks_ceil64(USEC_PER_SEC / config->fps);
+	player.start = k_uptime_ticks();
+
+	k_thread_create(&ili9163c_player_thread, ili9163c_player_stack,
+			K_THREAD_STACK_SIZEOF(ili9163c_player_stack), ili9163c_player_reader,
+			&player, NULL, NULL, CONFIG_ILI9163C_PLAYER_READER_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&ili9163c_player_thread, "ili9163c_player");
+
+	desc.width = config->width;
+	desc.pitch = config->width;
+
+	while (true) {
+		if (k_msgq_get(&ili9163c_player_ready, &chunk, K_NO_WAIT) < 0) {
+			result.underruns++;
+			k_msgq_get(&ili9163c_player_ready, &chunk, K_FOREVER);
+		}
+
+		if (chunk.rows == 0U) {
+			break;
+		}
+
+		/* Pace on the first rows of each frame, later rows follow immediately. */
+		if (chunk.row == 0U) {
+			int64_t deadline = ili9163c_player_deadline(&player, chunk.frame);
+			int64_t now = k_uptime_ticks();
+
+			if (now < deadline) {
+				k_sleep(K_TIMEOUT_ABS_TICKS(deadline));
+			} else if (now > deadline + player.period) {
+				result.late++;
+			}
+		}
+
+		desc.height = chunk.rows;
+		desc.buf_size = chunk.rows * player.row_size;
+
+		start = k_cycle_get_32();
+		r = display_write(config->display, config->x, config->y + chunk.row, &desc,
+				  ili9163c_player_bufs[chunk.buf]);
+		result.write_us += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		k_msgq_put(&ili9163c_player_free, &chunk.buf, K_NO_WAIT);
+
+		if (r < 0) {
+			LOG_ERR("Could not write frame %u (%d)", chunk.frame, r);
+			ili9163c_player_stop();
+			break;
+		}
+
+		if (chunk.row + chunk.rows == config->height) {
+			result.frames++;
+		}
+	}
+
+	/* The reader may still wait on a buffer or on the ready queue. */
+	while (k_thread_join(&ili9163c_player_thread, K_NO_WAIT) < 0) {
+		ili9163c_player_stop();
+		if ((k_msgq_get(&ili9163c_player_ready, &chunk, K_MSEC(1)) == 0) &&
+		    (chunk.rows != 0U)) {
+			k_msgq_put(&ili9163c_player_free, &chunk.buf, K_NO_WAIT);
+		}
+	}
+
+	fs_close(&player.file);
+
+	result.dropped = player.dropped;
+	result.read_us = k_cyc_to_us_floor64(player.read_cycles);
+	if (stats != NULL) {
+		*stats = result;
+	}
+
+	k_mutex_unlock(&ili9163c_player_lock);
+
+	return (r < 0) ? r : player.read_err;
+}
+
+void ili9163c_player_stop(void)
+{
+	atomic_set(&ili9163c_player_stopping, 1);
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/display/ili9163c_text.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ili9163c_text, CONFIG_DISPLAY_LOG_LEVEL);
+
+#define ILI9163C_TEXT_EMPTY UINT16_MAX
+#define ILI9163C_TEXT_WAYS  2U
+
+/* Expanded glyphs, valid for one font, pair of colors and pixel format. */
+struct ili9163c_text_cache {
+	const struct ili9163c_font *font;
+	uint32_t fg;
+	uint32_t bg;
+	enum display_pixel_format pixel_format;
+	/* Bytes per pixel. */
+	size_t bpp;
+	/* Bytes per expanded glyph. */
+	size_t glyph_size;
+	/* Glyph slots, in sets of ways, character c is cached in set c % sets. */
+	uint16_t slots;
+	uint16_t sets;
+	uint8_t ways;
+	uint16_t tags[CONFIG_ILI9163C_TEXT_CACHE_GLYPHS];
+	/* Least recently used way of each set. */
+	uint8_t lru[CONFIG_ILI9163C_TEXT_CACHE_GLYPHS];
+	/* Pixel for each coverage level. */
+	uint8_t palette[16][3];
+	struct ili9163c_text_stats stats;
+};
+
+static struct ili9163c_text_cache ili9163c_text_cache;
+static uint8_t ili9163c_text_glyphs[CONFIG_ILI9163C_TEXT_CACHE_SIZE] __aligned(4);
+static uint8_t ili9163c_text_line[CONFIG_ILI9163C_TEXT_BUFFER_SIZE] __aligned(4);
+
+K_MUTEX_DEFINE(ili9163c_text_lock);
+
+static void ili9163c_text_select(struct ili9163c_text_cache *cache,
+				 const struct ili9163c_text_style *style,
+				 enum display_pixel_format pixel_format)
+{
+	const struct ili9163c_font *font = style->font;
+	uint8_t levels = BIT(font->bpp) - 1U;
+	uint32_t rgb;
+
+	if ((cache->font == font) && (cache->fg == style->fg) && (cache->bg == style->bg) &&
+	    (cache->pixel_format == pixel_format) && (cache->slots != 0U)) {
+		return;
+	}
+
+	if (cache->slots != 0U) {
+		cache->stats.flushes++;
+	}
+
+	cache->font = font;
+	cache->fg = style->fg;
+	cache->bg = style->bg;
+	cache->pixel_format = pixel_format;
+	cache->bpp = (pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+	cache->glyph_size = font->width * font->height * cache->bpp;
+	cache->slots = MIN(CONFIG_ILI9163C_TEXT_CACHE_SIZE / cache->glyph_size,
+			   CONFIG_ILI9163C_TEXT_CACHE_GLYPHS);
+
+	cache->ways = MIN(cache->slots, ILI9163C_TEXT_WAYS);
+	cache->sets = cache->slots / cache->ways;
+
+	for (uint16_t i = 0U; i < cache->slots; i++) {
+		cache->tags[i] = ILI9163C_TEXT_EMPTY;
+		cache->lru[i] = 0U;
+	}
+
+	/* Blend each channel linearly from the background to the foreground. */
+	for (uint8_t level = 0U; level <= levels; level++) {
+		rgb = 0U;
+		for (int shift = 0; shift < 24; shift += 8) {
+			rgb |= ((((style->bg >> shift) & 0xFFU) * (levels - level) +
+				 ((style->fg >> shift) & 0xFFU) * level + levels / 2U) /
+				levels)
+			       << shift;
+		}
+
+		if (pixel_format == PIXEL_FORMAT_RGB_565) {
+			sys_put_be16(((rgb >> 8) & 0xF800U) | ((rgb >> 5) & 0x07E0U) |
+					     ((rgb >> 3) & 0x001FU),
+				     cache->palette[level]);
+		} else {
+			sys_put_be24(rgb, cache->palette[level]);
+		}
+	}
+}
+
+static const uint8_t *ili9163c_text_glyph(struct ili9163c_text_cache *cache, uint8_t c)
+{
+	const struct ili9163c_font *font = cache->font;
+	size_t stride = DIV_ROUND_UP(font->width * font->bpp, 8U);
+	uint16_t set = c % cache->sets;
+	uint8_t mask = BIT(font->bpp) - 1U;
+	const uint8_t *src;
+	uint8_t *glyph;
+	uint8_t *dst;
+	uint8_t level;
+	uint16_t slot;
+	size_t bit;
+
+	for (uint8_t way = 0U; way < cache->ways; way++) {
+		slot = set * cache->ways + way;
+		if (cache->tags[slot] == c) {
+			cache->lru[set] = (way + 1U) % cache->ways;
+			cache->stats.hits++;
+			return &ili9163c_text_glyphs[slot * cache->glyph_size];
+		}
+	}
+
+	cache->stats.misses++;
+
+	slot = set * cache->ways + cache->lru[set];
+	cache->lru[set] = (cache->lru[set] + 1U) % cache->ways;
+	glyph = &ili9163c_text_glyphs[slot * cache->glyph_size];
+	dst = glyph;
+
+	src = &font->glyphs[(c - font->first) * stride * font->height];
+	for (uint8_t row = 0U; row < font->height; row++) {
+		for (uint8_t col = 0U; col < font->width; col++) {
+			bit = col * font->bpp;
+			level = (src[bit / 8U] >> (8U - font->bpp - bit % 8U)) & mask;
+			memcpy(dst, cache->palette[level], cache->bpp);
+			dst += cache->bpp;
+		}
+		src += stride;
+	}
+
+	cache->tags[slot] = c;
+
+	return glyph;
+}
+
+static uint8_t ili9163c_text_char(const struct ili9163c_font *font, char c)
+{
+	if (((uint8_t)c >= font->first) && ((uint8_t)c <= font->last)) {
+		return c;
+	}
+
+	if (('?' >= font->first) && ('?' <= font->last)) {
+		return '?';
+	}
+
+	return font->first;
+}
+
+int ili9163c_text_draw(const struct device *dev, const struct ili9163c_text_style *style,
+		       uint16_t x, uint16_t y, const char *text)
+{
+	struct ili9163c_text_cache *cache = &ili9163c_text_cache;
+	const struct ili9163c_font *font = style->font;
+	struct display_capabilities capabilities;
+	struct display_buffer_descriptor desc;
+	const uint8_t *glyph;
+	uint8_t *dst;
+	size_t glyph_size;
+	uint16_t per_write;
+	uint16_t count;
+	uint16_t cols;
+	int r = 0;
+
+	if (((font->bpp != 1U) && (font->bpp != 4U)) || (font->width == 0U) ||
+	    (font->height == 0U) || (font->first > font->last)) {
+		return -EINVAL;
+	}
+
+	display_get_capabilities(dev, &capabilities);
+	if ((capabilities.current_pixel_format != PIXEL_FORMAT_RGB_565) &&
+	    (capabilities.current_pixel_format != PIXEL_FORMAT_RGB_888)) {
+		return -ENOTSUP;
+	}
+
+	glyph_size = font->width * font->height *
+		     ((capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U);
+	if ((glyph_size > CONFIG_ILI9163C_TEXT_CACHE_SIZE) ||
+	    (glyph_size > CONFIG_ILI9163C_TEXT_BUFFER_SIZE)) {
+		LOG_ERR("Glyphs do not fit in the buffers");
+		return -EINVAL;
+	}
+
+	if ((x >= capabilities.x_resolution) || (y >= capabilities.y_resolution)) {
+		return 0;
+	}
+
+	per_write = CONFIG_ILI9163C_TEXT_BUFFER_SIZE / glyph_size;
+	desc.height = MIN(font->height, capabilities.y_resolution - y);
+
+	k_mutex_lock(&ili9163c_text_lock, K_FOREVER);
+
+	ili9163c_text_select(cache, style, capabilities.current_pixel_format);
+
+	while ((*text != '\0') && (x < capabilities.x_resolution)) {
+		/* As many glyphs as the line buffer holds, the last one clipped to the display. */
+		count = 0U;
+		desc.width = 0U;
+		while ((text[count] != '\0') && (count < per_write) &&
+		       (x + desc.width < capabilities.x_resolution)) {
+			desc.width += MIN(font->width, capabilities.x_resolution - x - desc.width);
+			count++;
+		}
+
+		desc.pitch = desc.width;
+		desc.buf_size = desc.width * desc.height * cache->bpp;
+
+		for (uint16_t i = 0U; i < count; i++) {
+			glyph = ili9163c_text_glyph(cache, ili9163c_text_char(font, text[i]));
+			cols = MIN(font->width, desc.width - i * font->width);
+			dst = &ili9163c_text_line[i * font->width * cache->bpp];
+
+			for (uint16_t row = 0U; row < desc.height; row++) {
+				memcpy(dst, glyph, cols * cache->bpp);
+				dst += desc.pitch * cache->bpp;
+				glyph += font->width * cache->bpp;
+			}
+		}
+
+		r = display_write(dev, x, y, &desc, ili9163c_text_line);
+		cache->stats.writes++;
+		if (r < 0) {
+			LOG_ERR("Could not write text (%d)", r);
+			break;
+		}
+
+		cache->stats.chars += count;
+		x += desc.width;
+		text += count;
+	}
+
+	k_mutex_unlock(&ili9163c_text_lock);
+
+	return r;
+}
+
+void ili9163c_text_get_stats(struct ili9163c_text_stats *stats)
+{
+	k_mutex_lock(&ili9163c_text_lock, K_FOREVER);
+	*stats = ili9163c_text_cache.stats;
+	k_mutex_unlock(&ili9163c_text_lock);
+}
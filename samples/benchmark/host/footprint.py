@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024, CATIE
+# SPDX-License-Identifier: Apache-2.0
+
+"""Print the host figures of the fixed configuration section of the benchmark README.
+
+The ILI9163C driver is built for the host with gcc, against the stub kernel
+and MIPI-DBI bus of this directory, with and without
+CONFIG_ILI9163C_FIXED_CONFIG. The script prints, as Markdown tables:
+
+- the size of ili9163c.o, with the driver defaults and the prj.conf options,
+- the CPU cycles of display_write(), read with rdtsc, with the prj.conf options,
+- the bytes each write sends on the bus, and their time at the bus clock.
+
+The stub bus returns at once, so the cycles are the driver CPU time only. On
+a board, the bus time is added to them, unless the MIPI-DBI driver sends in
+the background. Requires gcc and binutils on an x86 host.
+
+Example:
+
+    samples/benchmark/host/footprint.py --runs 3
+"""
+
+import argparse
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+
+HOST = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HOST, "..", "..", ".."))
+DRIVER = os.path.join(ROOT, "drivers", "display", "ilitek", "ili9163c")
+
+CFLAGS = [
+    "-Os",
+    "-std=gnu11",
+    "-Wall",
+    "-ffunction-sections",
+    "-fdata-sections",
+    "-fno-asynchronous-unwind-tables",
+    "-I" + os.path.join(HOST, "include"),
+    "-I" + os.path.join(ROOT, "include"),
+    "-I" + DRIVER,
+]
+
+# Kconfig symbols set for every build, CONFIG_DISPLAY_LOG_LEVEL_ERR as in prj.conf.
+BASE = {
+    "CONFIG_DISPLAY_LOG_LEVEL": 1,
+    "CONFIG_KERNEL_INIT_PRIORITY_DEFAULT": 40,
+    "CONFIG_DISPLAY_INIT_PRIORITY": 85,
+}
+
+# Driver options of prj.conf, with their Kconfig defaults. The mirror selects the write hook.
+PRJ = {
+    "CONFIG_ILI9163C_RESYNC": 1,
+    "CONFIG_ILI9163C_RESYNC_PERIOD_MS": 0,
+    "CONFIG_ILI9163C_RESYNC_PRIORITY": 14,
+    "CONFIG_ILI9163C_RESYNC_STACK_SIZE": 1024,
+    "CONFIG_ILI9163C_PREEMPTIBLE_WRITE": 1,
+    "CONFIG_ILI9163C_WRITE_CHUNK_ROWS": 8,
+    "CONFIG_ILI9163C_WRITE_URGENT_PIXELS": 256,
+    "CONFIG_ILI9163C_BUF_POOL": 1,
+    "CONFIG_ILI9163C_BUF_COUNT": 2,
+    "CONFIG_ILI9163C_BUF_SIZE": 2048,
+    "CONFIG_ILI9163C_BUF_ALIGN": 32,
+    "CONFIG_ILI9163C_WRITE_HOOK": 1,
+    "CONFIG_ILI9163C_RGB444": 1,
+}
+
+FIXED = {"CONFIG_ILI9163C_FIXED_CONFIG": 1}
+
+# Devicetree pixel-format values, see include/zephyr/dt-bindings/display/ili9163c.h.
+PIXEL_FORMATS = {"RGB565": 0, "RGB444": 2}
+
+# mipi-max-frequency of the host devicetree, as in sixtron_bus.overlay.
+BUS_HZ = 20000000
+
+WRITES = {
+    "16x16": "16x16",
+    "64x16_strided": "64x16, strided",
+    "128x16": "128x16",
+    "128x160": "128x160, one write",
+}
+
+
+def defines(*configs):
+    out = []
+    for config in configs:
+        out += [f"-D{name}={value}" for name, value in config.items()]
+    return out
+
+
+def run(cmd):
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.exit(f"error: {' '.join(cmd)}\n{result.stderr}")
+    return result.stdout
+
+
+def size(obj, configs):
+    run(["gcc", *CFLAGS, *defines(*configs), "-c", os.path.join(DRIVER, "ili9163c.c"), "-o", obj])
+    line = run(["size", obj]).splitlines()[1].split()
+    return int(line[0]), int(line[1]), int(line[2])
+
+
+def build(exe, configs, pixel_format):
+    sources = [
+        os.path.join(DRIVER, "ili9163c.c"),
+        os.path.join(DRIVER, "ili9163c_buf.c"),
+        os.path.join(HOST, "stubs.c"),
+        os.path.join(HOST, "main.c"),
+    ]
+    run(
+        [
+            "gcc",
+            *CFLAGS,
+            *defines(*configs),
+            f"-DHOST_DT_pixel_format={pixel_format}",
+            *sources,
+            "-o",
+            exe,
+        ]
+    )
+
+
+def measure(exe, runs):
+    """Mean over the runs of the median cycles of each write, and its bus bytes."""
+    cycles = {}
+    bus_bytes = {}
+    for _ in range(runs):
+        for line in run([exe]).splitlines():
+            name, median, sent = line.split()
+            cycles.setdefault(name, []).append(int(median))
+            bus_bytes[name] = int(sent)
+    return {name: round(statistics.mean(c)) for name, c in cycles.items()}, bus_bytes
+
+
+def table(header, rows):
+    widths = [max(len(str(row[i])) for row in [header, *rows]) for i in range(len(header))]
+    # The first column is left aligned, the figures are right aligned.
+    rules = ["-" * (widths[0] + 2)] + ["-" * (w + 1) + ":" for w in widths[1:]]
+    lines = ["| " + " | ".join(h.ljust(w) for h, w in zip(header, widths)) + " |"]
+    lines.append("|" + "|".join(rules) + "|")
+    for row in rows:
+        cells = [str(row[0]).ljust(widths[0])]
+        cells += [str(c).rjust(w) for c, w in zip(row[1:], widths[1:])]
+        lines.append("| " + " | ".join(cells) + " |")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("--runs", type=int, default=2, help="runs averaged for the cycles")
+    args = parser.parse_args()
+
+    if platform.machine() not in ("x86_64", "i686", "i386"):
+        sys.exit("error: the cycles are read with rdtsc, an x86 host is required")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        obj = os.path.join(tmp, "ili9163c.o")
+        sizes = []
+        for name, options in (("defaults", {}), ("`prj.conf`", PRJ)):
+            for fixed in (False, True):
+                configs = [BASE, options] + ([FIXED] if fixed else [])
+                label = name + (", fixed" if fixed else "")
+                sizes.append([label, *size(obj, configs)])
+
+        cycles = {}
+        bus_bytes = {}
+        for fmt, value in PIXEL_FORMATS.items():
+            for fixed in (False, True):
+                exe = os.path.join(tmp, f"bench_{value}_{int(fixed)}")
+                build(exe, [BASE, PRJ] + ([FIXED] if fixed else []), value)
+                cycles[(fmt, fixed)], bus_bytes[fmt] = measure(exe, args.runs)
+
+    print(f"gcc {run(['gcc', '-dumpfullversion']).strip()}, {platform.machine()}\n")
+
+    print("Size of `ili9163c.c` in bytes. Text includes read-only data:\n")
+    print(table(["Driver options", "text", "data", "bss"], sizes))
+
+    print(f"\nCPU cycles per `display_write()`, median of each run, mean of {args.runs} runs:\n")
+    header = ["Write"]
+    for fmt in PIXEL_FORMATS:
+        header += [fmt, f"{fmt}, fixed"]
+    rows = []
+    for key, label in WRITES.items():
+        row = [label]
+        for fmt in PIXEL_FORMATS:
+            row += [cycles[(fmt, False)][key], cycles[(fmt, True)][key]]
+        rows.append(row)
+    print(table(header, rows))
+
+    print(f"\nBytes sent on the bus per write, and their time at {BUS_HZ // 1000000} MHz:\n")
+    header = ["Write"]
+    for fmt in PIXEL_FORMATS:
+        header += [f"{fmt} bytes", f"{fmt} us"]
+    rows = []
+    for key, label in WRITES.items():
+        row = [label]
+        for fmt in PIXEL_FORMATS:
+            sent = bus_bytes[fmt][key]
+            row += [sent, round(sent * 8 * 1000000 / BUS_HZ)]
+        rows.append(row)
+    print(table(header, rows))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
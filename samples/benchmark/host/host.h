@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include <stdint.h>
+
+/* Bytes the stub bus would have sent since the start. */
+extern uint64_t host_bus_bytes;
+
+#endif /* HOST_H_ */
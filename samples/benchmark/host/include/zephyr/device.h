@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host stand-in for the device model and the devicetree: a single ILI9163C
+ * instance with the binding defaults, 128x160 at rotation 0 on a 20 MHz bus.
+ * The pixel format is given with -DHOST_DT_pixel_format.
+ */
+
+#ifndef HOST_ZEPHYR_DEVICE_H_
+#define HOST_ZEPHYR_DEVICE_H_
+
+#include <zephyr/kernel.h>
+
+struct device {
+	const char *name;
+	const void *config;
+	const void *api;
+	void *data;
+};
+
+bool device_is_ready(const struct device *dev);
+
+#define HOST_DT_width               128
+#define HOST_DT_height              160
+#define HOST_DT_rotation            0
+#define HOST_DT_display_inversion   0
+#define HOST_DT_present_shadow      0
+#define HOST_DT_mipi_max_frequency  20000000
+#define HOST_DT_gamset              {0x04}
+#define HOST_DT_gamadj              {0x01}
+#define HOST_DT_frmctr1             {0x0E, 0x14}
+#define HOST_DT_pwctrl1             {0x0A, 0x05}
+#define HOST_DT_pwctrl2             {0x07}
+#define HOST_DT_vmctrl1             {0x43, 0x4D}
+#define HOST_DT_vmctrl2             {0x40}
+#define HOST_DT_pgamctrl                                                                           \
+	{0x3F, 0x25, 0x1C, 0x1E, 0x20, 0x12, 0x2A, 0x90, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00}
+#define HOST_DT_ngamctrl                                                                           \
+	{0x20, 0x20, 0x20, 0x20, 0x05, 0x00, 0x15, 0xA7, 0x3D, 0x18, 0x25, 0x2A, 0x2B, 0x2B, 0x3A}
+
+#ifndef HOST_DT_pixel_format
+#define HOST_DT_pixel_format 0
+#endif
+
+#define DT_INST(n, compat)               n
+#define DT_PARENT(node)                  node
+#define DT_NUM_INST_STATUS_OKAY(compat)  1
+#define DT_INST_FOREACH_STATUS_OKAY(fn)  fn(0)
+#define DT_INST_PROP(n, prop)            HOST_DT_##prop
+#define DT_INST_ENUM_IDX(n, prop)        0
+
+extern const struct device host_mipi_dev;
+extern const struct device host_display_dev;
+extern int (*const host_display_init)(const struct device *dev);
+
+#define DEVICE_DT_GET(node) (&host_mipi_dev)
+
+#define DEVICE_DT_INST_DEFINE(n, init_fn, pm, data, config, level, prio, api)                     \
+	const struct device host_display_dev = {"ili9163c", config, api, data};                    \
+	int (*const host_display_init)(const struct device *dev) = init_fn
+
+#endif /* HOST_ZEPHYR_DEVICE_H_ */
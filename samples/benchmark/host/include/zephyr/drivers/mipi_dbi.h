@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the MIPI-DBI API, see the bus in stubs.c. */
+
+#ifndef HOST_ZEPHYR_DRIVERS_MIPI_DBI_H_
+#define HOST_ZEPHYR_DRIVERS_MIPI_DBI_H_
+
+#include <zephyr/drivers/display.h>
+
+#define MIPI_DBI_MODE_SPI_4WIRE 2U
+
+#define SPI_OP_MODE_MASTER 0U
+#define SPI_WORD_SET(size) ((size) << 5)
+
+struct spi_config {
+	uint32_t frequency;
+	uint16_t operation;
+};
+
+struct mipi_dbi_config {
+	uint8_t mode;
+	struct spi_config config;
+};
+
+#define MIPI_DBI_SPI_CONFIG_DT_INST(n, op, delay)                                                 \
+	{                                                                                          \
+		.frequency = DT_INST_PROP(n, mipi_max_frequency), .operation = (op),               \
+	}
+
+int mipi_dbi_command_write(const struct device *dev, const struct mipi_dbi_config *config,
+			   uint8_t cmd, const uint8_t *data, size_t len);
+int mipi_dbi_command_read(const struct device *dev, const struct mipi_dbi_config *config,
+			  uint8_t *cmds, size_t num_cmds, uint8_t *response, size_t len);
+int mipi_dbi_write_display(const struct device *dev, const struct mipi_dbi_config *config,
+			   const uint8_t *framebuf, struct display_buffer_descriptor *desc,
+			   enum display_pixel_format pixfmt);
+int mipi_dbi_reset(const struct device *dev, uint32_t delay_ms);
+
+#endif /* HOST_ZEPHYR_DRIVERS_MIPI_DBI_H_ */
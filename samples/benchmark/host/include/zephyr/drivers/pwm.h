@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the PWM API, the instance has no backlight PWM. */
+
+#ifndef HOST_ZEPHYR_DRIVERS_PWM_H_
+#define HOST_ZEPHYR_DRIVERS_PWM_H_
+
+#include <zephyr/device.h>
+
+struct pwm_dt_spec {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t period;
+	uint16_t flags;
+};
+
+#define PWM_DT_SPEC_INST_GET_OR(n, default_value) default_value
+
+bool pwm_is_ready_dt(const struct pwm_dt_spec *spec);
+int pwm_set_dt(const struct pwm_dt_spec *spec, uint32_t period, uint32_t pulse);
+
+#endif /* HOST_ZEPHYR_DRIVERS_PWM_H_ */
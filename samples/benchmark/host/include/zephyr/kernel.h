@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the kernel API used by the ILI9163C driver, see stubs.c. */
+
+#ifndef HOST_ZEPHYR_KERNEL_H_
+#define HOST_ZEPHYR_KERNEL_H_
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+typedef struct {
+	int64_t ticks;
+} k_timeout_t;
+
+#define K_NO_WAIT ((k_timeout_t){0})
+#define K_FOREVER ((k_timeout_t){-1})
+#define K_MSEC(ms) ((k_timeout_t){(ms)})
+
+struct k_mutex {
+	int unused;
+};
+
+struct k_condvar {
+	int unused;
+};
+
+struct k_timer {
+	int unused;
+};
+
+struct k_work {
+	int unused;
+};
+
+struct k_work_delayable {
+	struct k_work work;
+};
+
+struct k_work_q {
+	int unused;
+};
+
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+#define K_THREAD_STACK_DEFINE(name, size) uint8_t name[size]
+#define K_THREAD_STACK_SIZEOF(stack)      sizeof(stack)
+
+/* Init functions are not run on the host, main() only initializes the device. */
+#define SYS_INIT(fn, level, prio) static int (*const host_sys_init_##fn)(void) __unused = fn
+
+#define CONTAINER_OF(ptr, type, field) ((type *)(((char *)(ptr)) - offsetof(type, field)))
+
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+#define __ASSERT(cond, ...)     ((void)0)
+#define __ASSERT_NO_MSG(cond)   ((void)0)
+
+#define __aligned(x)  __attribute__((__aligned__(x)))
+#define __noinline    __attribute__((__noinline__))
+#define __unused      __attribute__((__unused__))
+#define ALWAYS_INLINE inline __attribute__((__always_inline__))
+
+int k_mutex_init(struct k_mutex *mutex);
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
+int k_mutex_unlock(struct k_mutex *mutex);
+
+int k_condvar_init(struct k_condvar *condvar);
+int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex, k_timeout_t timeout);
+int k_condvar_broadcast(struct k_condvar *condvar);
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+struct k_work_delayable *k_work_delayable_from_work(struct k_work *work);
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+			      k_timeout_t delay);
+int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+				k_timeout_t delay);
+void k_work_queue_init(struct k_work_q *queue);
+void k_work_queue_start(struct k_work_q *queue, void *stack, size_t stack_size, int prio,
+			const void *cfg);
+
+int32_t k_sleep(k_timeout_t timeout);
+uint32_t k_cycle_get_32(void);
+
+#endif /* HOST_ZEPHYR_KERNEL_H_ */
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for logging at CONFIG_DISPLAY_LOG_LEVEL_ERR, as in prj.conf. */
+
+#ifndef HOST_ZEPHYR_LOGGING_LOG_H_
+#define HOST_ZEPHYR_LOGGING_LOG_H_
+
+void host_log_err(const char *fmt, ...);
+
+#define LOG_MODULE_REGISTER(...)
+#define LOG_MODULE_DECLARE(...)
+
+#define LOG_ERR(...) host_log_err(__VA_ARGS__)
+#define LOG_WRN(...) ((void)0)
+#define LOG_INF(...) ((void)0)
+#define LOG_DBG(...) ((void)0)
+
+#define LOG_HEXDUMP_DBG(data, length, str) ((void)0)
+
+#endif /* HOST_ZEPHYR_LOGGING_LOG_H_ */
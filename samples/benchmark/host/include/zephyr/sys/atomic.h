@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the atomic API, with the GCC builtins. */
+
+#ifndef HOST_ZEPHYR_SYS_ATOMIC_H_
+#define HOST_ZEPHYR_SYS_ATOMIC_H_
+
+#include <stdbool.h>
+
+typedef long atomic_t;
+typedef atomic_t atomic_val_t;
+
+static inline atomic_val_t atomic_get(const atomic_t *target)
+{
+	return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline bool atomic_cas(atomic_t *target, atomic_val_t old_value, atomic_val_t new_value)
+{
+	return __atomic_compare_exchange_n(target, &old_value, new_value, false, __ATOMIC_SEQ_CST,
+					   __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_inc(atomic_t *target)
+{
+	return __atomic_fetch_add(target, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_dec(atomic_t *target)
+{
+	return __atomic_fetch_sub(target, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline bool atomic_test_bit(const atomic_t *target, int bit)
+{
+	return ((atomic_get(target) >> bit) & 1L) != 0L;
+}
+
+static inline void atomic_clear_bit(atomic_t *target, int bit)
+{
+	__atomic_fetch_and(target, ~(1L << bit), __ATOMIC_SEQ_CST);
+}
+
+#endif /* HOST_ZEPHYR_SYS_ATOMIC_H_ */
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the byte order helpers, for a little endian host. */
+
+#ifndef HOST_ZEPHYR_SYS_BYTEORDER_H_
+#define HOST_ZEPHYR_SYS_BYTEORDER_H_
+
+#include <stdint.h>
+
+#define sys_cpu_to_be16(val) __builtin_bswap16(val)
+
+#endif /* HOST_ZEPHYR_SYS_BYTEORDER_H_ */
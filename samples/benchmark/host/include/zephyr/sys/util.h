@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the utility macros used by the ILI9163C driver. */
+
+#ifndef HOST_ZEPHYR_SYS_UTIL_H_
+#define HOST_ZEPHYR_SYS_UTIL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BIT(n)              (1UL << (n))
+#define MIN(a, b)           (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)           (((a) > (b)) ? (a) : (b))
+#define CLAMP(val, lo, hi)  MIN(MAX(val, lo), hi)
+#define ARRAY_SIZE(array)   (sizeof(array) / sizeof((array)[0]))
+#define ARG_UNUSED(x)       (void)(x)
+#define DIV_ROUND_UP(n, d)  (((n) + (d) - 1) / (d))
+#define ROUND_UP(x, align)  (DIV_ROUND_UP(x, align) * (align))
+#define IS_POWER_OF_TWO(x)  (((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
+
+#define POPCOUNT(x)    __builtin_popcount(x)
+#define __maybe_unused __attribute__((__unused__))
+
+/* Same expansion as Zephyr: 1 for a macro defined to 1, 0 otherwise. */
+#define Z_XXXX1                            Z_YYYY,
+#define Z_IS_ENABLED1(macro)               Z_IS_ENABLED2(Z_XXXX##macro)
+#define Z_IS_ENABLED2(one_or_two_args)     Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...) val
+#define IS_ENABLED(macro)                  Z_IS_ENABLED1(macro)
+
+#define Z_DEBRACKET(...)                         __VA_ARGS__
+#define Z_GET_ARG2_DEBRACKET(ignore_this, val, ...) Z_DEBRACKET val
+#define Z_COND_CODE(one_or_two_args, if_code, else_code)                                           \
+	Z_GET_ARG2_DEBRACKET(one_or_two_args if_code, else_code)
+#define Z_COND_CODE_1(flag, if_1_code, else_code) Z_COND_CODE(Z_XXXX##flag, if_1_code, else_code)
+#define COND_CODE_1(flag, if_1_code, else_code)   Z_COND_CODE_1(flag, if_1_code, else_code)
+#define IF_ENABLED(flag, code)                    COND_CODE_1(flag, code, ())
+
+static inline unsigned int find_lsb_set(uint32_t op)
+{
+	return __builtin_ffs(op);
+}
+
+#endif /* HOST_ZEPHYR_SYS_UTIL_H_ */
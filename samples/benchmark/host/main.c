@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host benchmark of the ILI9163C write path, run by footprint.py. Each write
+ * is timed with rdtsc, and the median of the samples is printed with the
+ * bytes the write sends on the bus.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <x86intrin.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include "host.h"
+
+#define HOST_WARMUP  1000
+#define HOST_SAMPLES 20001
+
+struct host_write {
+	const char *name;
+	uint16_t width;
+	uint16_t height;
+	uint16_t pitch;
+};
+
+static const struct host_write host_writes[] = {
+	{"16x16", 16U, 16U, 16U},
+	{"64x16_strided", 64U, 16U, 128U},
+	{"128x16", 128U, 16U, 128U},
+	{"128x160", 128U, 160U, 128U},
+};
+
+/* RGB565 input, also for RGB444 instances which pack it on the fly. */
+static uint8_t host_buf[128 * 160 * 2] __aligned(32);
+static uint64_t host_samples[HOST_SAMPLES];
+
+static int host_compare(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void host_measure(const struct host_write *write)
+{
+	const struct display_driver_api *api = host_display_dev.api;
+	struct display_buffer_descriptor desc = {
+		.buf_size = write->pitch * write->height * 2U,
+		.width = write->width,
+		.height = write->height,
+		.pitch = write->pitch,
+	};
+	uint64_t bus_bytes;
+	uint64_t start;
+
+	for (int i = 0; i < HOST_WARMUP; i++) {
+		api->write(&host_display_dev, 0U, 0U, &desc, host_buf);
+	}
+
+	bus_bytes = host_bus_bytes;
+	api->write(&host_display_dev, 0U, 0U, &desc, host_buf);
+	bus_bytes = host_bus_bytes - bus_bytes;
+
+	for (int i = 0; i < HOST_SAMPLES; i++) {
+		start = __rdtsc();
+		api->write(&host_display_dev, 0U, 0U, &desc, host_buf);
+		host_samples[i] = __rdtsc() - start;
+	}
+
+	qsort(host_samples, HOST_SAMPLES, sizeof(host_samples[0]), host_compare);
+
+	printf("%s %llu %llu\n", write->name, (unsigned long long)host_samples[HOST_SAMPLES / 2],
+	       (unsigned long long)bus_bytes);
+}
+
+int main(void)
+{
+	if (host_display_init(&host_display_dev) != 0) {
+		fprintf(stderr, "Display init failed\n");
+		return 1;
+	}
+
+	memset(host_buf, 0x5A, sizeof(host_buf));
+
+	for (size_t i = 0; i < ARRAY_SIZE(host_writes); i++) {
+		host_measure(&host_writes[i]);
+	}
+
+	return 0;
+}
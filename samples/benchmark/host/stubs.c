@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host stand-ins for the kernel and the MIPI-DBI bus. Locks and work queues
+ * do nothing, since the benchmark is single threaded. The bus returns at once
+ * and only counts the bytes it would shift out, so that the bus time can be
+ * computed for a given clock.
+ */
+
+#include <string.h>
+
+#include <x86intrin.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/mipi_dbi.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/kernel.h>
+
+#include "host.h"
+
+const struct device host_mipi_dev = {"mipi_dbi", NULL, NULL, NULL};
+
+uint64_t host_bus_bytes;
+
+void host_log_err(const char *fmt, ...)
+{
+	ARG_UNUSED(fmt);
+}
+
+bool device_is_ready(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return true;
+}
+
+bool pwm_is_ready_dt(const struct pwm_dt_spec *spec)
+{
+	ARG_UNUSED(spec);
+
+	return true;
+}
+
+int pwm_set_dt(const struct pwm_dt_spec *spec, uint32_t period, uint32_t pulse)
+{
+	ARG_UNUSED(spec);
+	ARG_UNUSED(period);
+	ARG_UNUSED(pulse);
+
+	return 0;
+}
+
+int k_mutex_init(struct k_mutex *mutex)
+{
+	ARG_UNUSED(mutex);
+
+	return 0;
+}
+
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(timeout);
+
+	return 0;
+}
+
+int k_mutex_unlock(struct k_mutex *mutex)
+{
+	ARG_UNUSED(mutex);
+
+	return 0;
+}
+
+int k_condvar_init(struct k_condvar *condvar)
+{
+	ARG_UNUSED(condvar);
+
+	return 0;
+}
+
+int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex, k_timeout_t timeout)
+{
+	ARG_UNUSED(condvar);
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(timeout);
+
+	return 0;
+}
+
+int k_condvar_broadcast(struct k_condvar *condvar)
+{
+	ARG_UNUSED(condvar);
+
+	return 0;
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler)
+{
+	ARG_UNUSED(dwork);
+	ARG_UNUSED(handler);
+}
+
+struct k_work_delayable *k_work_delayable_from_work(struct k_work *work)
+{
+	return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+			      k_timeout_t delay)
+{
+	ARG_UNUSED(queue);
+	ARG_UNUSED(dwork);
+	ARG_UNUSED(delay);
+
+	return 0;
+}
+
+int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+				k_timeout_t delay)
+{
+	ARG_UNUSED(queue);
+	ARG_UNUSED(dwork);
+	ARG_UNUSED(delay);
+
+	return 0;
+}
+
+void k_work_queue_init(struct k_work_q *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+void k_work_queue_start(struct k_work_q *queue, void *stack, size_t stack_size, int prio,
+			const void *cfg)
+{
+	ARG_UNUSED(queue);
+	ARG_UNUSED(stack);
+	ARG_UNUSED(stack_size);
+	ARG_UNUSED(prio);
+	ARG_UNUSED(cfg);
+}
+
+int32_t k_sleep(k_timeout_t timeout)
+{
+	ARG_UNUSED(timeout);
+
+	return 0;
+}
+
+uint32_t k_cycle_get_32(void)
+{
+	return (uint32_t)__rdtsc();
+}
+
+int mipi_dbi_command_write(const struct device *dev, const struct mipi_dbi_config *config,
+			   uint8_t cmd, const uint8_t *data, size_t len)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(config);
+	ARG_UNUSED(cmd);
+	ARG_UNUSED(data);
+
+	host_bus_bytes += 1U + len;
+
+	return 0;
+}
+
+int mipi_dbi_command_read(const struct device *dev, const struct mipi_dbi_config *config,
+			  uint8_t *cmds, size_t num_cmds, uint8_t *response, size_t len)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(config);
+	ARG_UNUSED(cmds);
+
+	memset(response, 0, len);
+	host_bus_bytes += num_cmds + len;
+
+	return 0;
+}
+
+int mipi_dbi_write_display(const struct device *dev, const struct mipi_dbi_config *config,
+			   const uint8_t *framebuf, struct display_buffer_descriptor *desc,
+			   enum display_pixel_format pixfmt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(config);
+	ARG_UNUSED(framebuf);
+	ARG_UNUSED(pixfmt);
+
+	host_bus_bytes += desc->buf_size;
+
+	return 0;
+}
+
+int mipi_dbi_reset(const struct device *dev, uint32_t delay_ms)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(delay_ms);
+
+	return 0;
+}
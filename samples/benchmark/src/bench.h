@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <zephyr/device.h>
+
+/**
+ * @brief Measure the cycles spent in display_write() for typical areas.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_write(const struct device *dev);
+
+/**
+ * @brief Inject faults in the emulator and measure resynchronization.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_resync(const struct device *dev);
+
+/**
+ * @brief Measure the overhead and the stream of screen mirroring.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_mirror(const struct device *dev);
+
+/**
+ * @brief Measure the latency of small writes during full frame writes.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_preempt(const struct device *dev);
+
+/**
+ * @brief Measure the frame time of banded rendering against the number of workers.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_bands(const struct device *dev);
+
+/**
+ * @brief Measure the text rendering throughput.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_text(const struct device *dev);
+
+/**
+ * @brief Measure sprite animation with the layer compositor.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_compose(const struct device *dev);
+
+/**
+ * @brief Measure the frame budget of the fixed rate present scheduler.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_present(const struct device *dev);
+
+/**
+ * @brief Verify the RGB444 packed stream in the emulator and measure its frame time.
+ *
+ * @param dev ILI9163C display device.
+ */
+void bench_rgb444(const struct device *dev);
+
+#endif /* BENCH_H_ */
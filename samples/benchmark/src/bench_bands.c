@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/display/ili9163c_bands.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_bands, CONFIG_LOG_DEFAULT_LEVEL);
+
+static uint8_t serial_buf[CONFIG_ILI9163C_BANDS_BUFFER_SIZE] __aligned(4);
+
+/* Shaded gradient, with CONFIG_SAMPLE_BENCH_BANDS_WORK rounds of extra work per pixel. */
+static void bench_bands_render(uint8_t *buf, const struct display_buffer_descriptor *desc,
+			       uint16_t y, uint32_t frame, void *user_data)
+{
+	enum display_pixel_format *format = user_data;
+	uint32_t v;
+
+	for (uint16_t row = 0U; row < desc->height; row++) {
+		for (uint16_t x = 0U; x < desc->width; x++) {
+			v = (x + frame) ^ (y + row);
+			for (int i = 0; i < CONFIG_SAMPLE_BENCH_BANDS_WORK; i++) {
+				v = (v * 1103515245U + 12345U) ^ (v >> 7);
+			}
+
+			v = ((x + frame) << 16) | ((y + row) << 8) | (v & 0x3FU);
+
+			if (*format == PIXEL_FORMAT_RGB_565) {
+				sys_put_be16(((v >> 8) & 0xF800U) | ((v >> 5) & 0x07E0U) |
+						     ((v >> 3) & 0x001FU),
+					     buf);
+				buf += 2;
+			} else {
+				*buf++ = v >> 16;
+				*buf++ = v >> 8;
+				*buf++ = v;
+			}
+		}
+	}
+}
+
+/* Reference: a single thread rendering a band, then writing it. */
+static uint32_t bench_bands_serial(const struct device *dev, enum display_pixel_format *format,
+				   uint16_t band_rows)
+{
+	struct display_capabilities capabilities;
+	struct display_buffer_descriptor desc;
+	uint64_t cycles = 0U;
+	uint32_t start;
+
+	display_get_capabilities(dev, &capabilities);
+
+	desc.width = capabilities.x_resolution;
+	desc.pitch = capabilities.x_resolution;
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+
+		for (uint16_t y = 0U; y < capabilities.y_resolution; y += band_rows) {
+			desc.height = MIN(band_rows, capabilities.y_resolution - y);
+			desc.buf_size = sizeof(serial_buf);
+			bench_bands_render(serial_buf, &desc, y, i, format);
+			display_write(dev, 0U, y, &desc, serial_buf);
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return (uint32_t)(cycles / CONFIG_SAMPLE_BENCH_ITERATIONS);
+}
+
+void bench_bands(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	static enum display_pixel_format format;
+	struct ili9163c_bands_stats stats;
+	struct ili9163c_bands_config config = {
+		.display = dev,
+		.render = bench_bands_render,
+		.user_data = &format,
+	};
+	int r;
+
+	display_get_capabilities(dev, &capabilities);
+	format = capabilities.current_pixel_format;
+
+	for (uint8_t workers = 1U; workers <= CONFIG_ILI9163C_BANDS_MAX_WORKERS; workers++) {
+		config.workers = workers;
+
+		r = ili9163c_bands_start(&config);
+		if (r < 0) {
+			LOG_ERR("Could not start the pipeline (%d)", r);
+			return;
+		}
+
+		for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+			ili9163c_bands_frame(i);
+		}
+
+		ili9163c_bands_stop();
+		ili9163c_bands_get_stats(&stats);
+
+		if (workers == 1U) {
+			LOG_INF("bands: %u CPUs, %u rows per band, serial frame %u us",
+				CONFIG_MP_MAX_NUM_CPUS, stats.band_rows,
+				k_cyc_to_us_floor32(bench_bands_serial(dev, &format,
+								       stats.band_rows)));
+		}
+
+		LOG_INF("bands: %u workers: frame %u us (max %u us), writer stalled %u us", workers,
+			k_cyc_to_us_floor32(stats.frame_cycles / stats.frames),
+			k_cyc_to_us_floor32(stats.max_frame_cycles),
+			k_cyc_to_us_floor32(stats.stall_cycles / stats.frames));
+	}
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/display/ili9163c_compose.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_compose, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_COMPOSE_SPRITES 4U
+#define BENCH_COMPOSE_SIZE    16U
+#define BENCH_COMPOSE_BG      0x203040U
+
+static uint8_t sprite[BENCH_COMPOSE_SIZE * BENCH_COMPOSE_SIZE * 3U];
+static struct ili9163c_layer layers[BENCH_COMPOSE_SPRITES];
+static int16_t speed[BENCH_COMPOSE_SPRITES][2];
+
+/* Shaded ball, surrounded by the key color. */
+static void bench_compose_sprite(enum display_pixel_format format, uint32_t key)
+{
+	const int c = BENCH_COMPOSE_SIZE - 1;
+	uint8_t *dst = sprite;
+	uint32_t rgb;
+	int d;
+
+	for (int y = 0; y < BENCH_COMPOSE_SIZE; y++) {
+		for (int x = 0; x < BENCH_COMPOSE_SIZE; x++) {
+			d = (2 * x - c) * (2 * x - c) + (2 * y - c) * (2 * y - c);
+			if (d > c * c) {
+				rgb = key;
+			} else {
+				rgb = 0xFF0000U | ((255U - d * 255U / (c * c)) << 8);
+			}
+
+			if (format == PIXEL_FORMAT_RGB_565) {
+				if (rgb != key) {
+					rgb = ((rgb >> 8) & 0xF800U) | ((rgb >> 5) & 0x07E0U) |
+					      ((rgb >> 3) & 0x001FU);
+				}
+				sys_put_be16(rgb, dst);
+				dst += 2;
+			} else {
+				sys_put_be24(rgb, dst);
+				dst += 3;
+			}
+		}
+	}
+}
+
+/* Move the sprites, bouncing on the edges of the display. */
+static void bench_compose_move(const struct display_capabilities *capabilities)
+{
+	for (size_t i = 0U; i < BENCH_COMPOSE_SPRITES; i++) {
+		layers[i].x += speed[i][0];
+		layers[i].y += speed[i][1];
+
+		if ((layers[i].x <= 0) ||
+		    (layers[i].x + BENCH_COMPOSE_SIZE >= capabilities->x_resolution)) {
+			speed[i][0] = -speed[i][0];
+		}
+		if ((layers[i].y <= 0) ||
+		    (layers[i].y + BENCH_COMPOSE_SIZE >= capabilities->y_resolution)) {
+			speed[i][1] = -speed[i][1];
+		}
+	}
+}
+
+/* Animate the sprites, return the average frame time in cycles. */
+static uint32_t bench_compose_frames(const struct display_capabilities *capabilities, bool full)
+{
+	uint64_t cycles = 0U;
+	uint32_t start;
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+
+		bench_compose_move(capabilities);
+		if (full) {
+			ili9163c_compose_invalidate(0U, 0U, capabilities->x_resolution,
+						    capabilities->y_resolution);
+		}
+		ili9163c_compose_update();
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return (uint32_t)(cycles / CONFIG_SAMPLE_BENCH_ITERATIONS);
+}
+
+void bench_compose(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	struct ili9163c_compose_stats before;
+	struct ili9163c_compose_stats after;
+	struct ili9163c_compose_config config = {
+		.display = dev,
+		.background_color = BENCH_COMPOSE_BG,
+		.layers = layers,
+		.layer_count = BENCH_COMPOSE_SPRITES,
+	};
+	uint32_t dirty;
+	uint32_t full;
+	uint32_t key;
+	uint32_t bpp;
+	int r;
+
+	display_get_capabilities(dev, &capabilities);
+	if (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) {
+		key = 0xF81FU;
+		bpp = 2U;
+	} else {
+		key = 0xFF00FFU;
+		bpp = 3U;
+	}
+
+	bench_compose_sprite(capabilities.current_pixel_format, key);
+
+	for (size_t i = 0U; i < BENCH_COMPOSE_SPRITES; i++) {
+		layers[i] = (struct ili9163c_layer){
+			.pixels = sprite,
+			.x = 8 + i * 24,
+			.y = 8 + i * 32,
+			.width = BENCH_COMPOSE_SIZE,
+			.height = BENCH_COMPOSE_SIZE,
+			.key = key,
+			.keyed = true,
+			.visible = true,
+		};
+		speed[i][0] = (i % 2U == 0U) ? 2 : -3;
+		speed[i][1] = 1 + i;
+	}
+
+	r = ili9163c_compose_init(&config);
+	if (r < 0) {
+		LOG_ERR("Could not start the compositor (%d)", r);
+		return;
+	}
+
+	ili9163c_compose_update();
+
+	ili9163c_compose_get_stats(&before);
+	dirty = bench_compose_frames(&capabilities, false);
+	ili9163c_compose_get_stats(&after);
+
+	full = bench_compose_frames(&capabilities, true);
+
+	LOG_INF("compose: %u sprites: changed areas %u us per frame, %u pixels in %u writes",
+		BENCH_COMPOSE_SPRITES, k_cyc_to_us_floor32(dirty),
+		(uint32_t)((after.pixels - before.pixels) / CONFIG_SAMPLE_BENCH_ITERATIONS),
+		(after.writes - before.writes) / CONFIG_SAMPLE_BENCH_ITERATIONS);
+	LOG_INF("compose: full screen %u us per frame, %u bytes of line buffer instead of a "
+		"%u bytes framebuffer",
+		k_cyc_to_us_floor32(full), CONFIG_ILI9163C_COMPOSE_BUFFER_SIZE,
+		capabilities.x_resolution * capabilities.y_resolution * bpp);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/display/ili9163c_mirror.h>
+#include <zephyr/drivers/display.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_mirror, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_MIRROR_BOX 16U
+
+static uint8_t background[BENCH_MIRROR_BOX * BENCH_MIRROR_BOX * 3U];
+static uint8_t box[BENCH_MIRROR_BOX * BENCH_MIRROR_BOX * 3U];
+
+/* Sink discarding the stream at the rate of a UART. */
+static int bench_mirror_sink(const uint8_t *data, size_t len, void *user_data)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(user_data);
+
+	k_busy_wait((uint64_t)len * 10U * USEC_PER_SEC / CONFIG_SAMPLE_BENCH_MIRROR_BAUDRATE);
+
+	return 0;
+}
+
+static uint32_t bench_mirror_frame(const struct device *dev, uint16_t x, uint16_t y, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = BENCH_MIRROR_BOX,
+		.height = BENCH_MIRROR_BOX,
+		.pitch = BENCH_MIRROR_BOX,
+		.buf_size = BENCH_MIRROR_BOX * BENCH_MIRROR_BOX * bpp,
+	};
+	uint32_t start = k_cycle_get_32();
+
+	/* A box moving over a plain background, as a typical UI animation. */
+	display_write(dev, x, y, &desc, background);
+	display_write(dev, x + 1U, y, &desc, box);
+
+	return k_cycle_get_32() - start;
+}
+
+static uint64_t bench_mirror_run(const struct device *dev, size_t bpp, uint16_t max_x)
+{
+	uint64_t cycles = 0U;
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		for (uint16_t x = 0U; x < max_x; x++) {
+			cycles += bench_mirror_frame(dev, x, 8U, bpp);
+		}
+	}
+
+	return cycles / CONFIG_SAMPLE_BENCH_ITERATIONS / max_x;
+}
+
+void bench_mirror(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	struct ili9163c_mirror_stats stats;
+	uint16_t max_x;
+	uint32_t plain;
+	uint32_t mirrored;
+	size_t bpp;
+	int r;
+
+	display_get_capabilities(dev, &capabilities);
+	bpp = (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+	max_x = capabilities.x_resolution - BENCH_MIRROR_BOX - 1U;
+
+	for (size_t i = 0U; i < sizeof(box); i++) {
+		background[i] = 0x18U;
+		box[i] = ((i / bpp) % BENCH_MIRROR_BOX < 2U) ? 0xFFU : 0xF1U;
+	}
+
+	plain = bench_mirror_run(dev, bpp, max_x);
+
+	r = ili9163c_mirror_start(dev, bench_mirror_sink, NULL);
+	if (r < 0) {
+		LOG_ERR("Could not start mirroring (%d)", r);
+		return;
+	}
+
+	mirrored = bench_mirror_run(dev, bpp, max_x);
+
+	ili9163c_mirror_stop();
+	ili9163c_mirror_get_stats(&stats);
+
+	LOG_INF("mirror: frame %u us, %u us mirrored, hook max %u us",
+		k_cyc_to_us_floor32(plain), k_cyc_to_us_floor32(mirrored),
+		k_cyc_to_us_floor32(stats.max_hook_cycles));
+	LOG_INF("mirror: %u writes, %u changed, %u updates, %u rects, %u coalesced", stats.writes,
+		stats.changed, stats.updates, stats.rects, stats.coalesced);
+	LOG_INF("mirror: %u bytes sent for %u raw bytes", (uint32_t)stats.bytes,
+		(uint32_t)stats.raw_bytes);
+}
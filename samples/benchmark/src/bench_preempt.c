@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_preempt, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_PREEMPT_BOX 16U
+#define BENCH_PREEMPT_PIXELS                                                                       \
+	(DT_PROP(DT_CHOSEN(zephyr_display), width) * DT_PROP(DT_CHOSEN(zephyr_display), height))
+
+static uint8_t frame[BENCH_PREEMPT_PIXELS * 2U] __aligned(4);
+static uint8_t box[BENCH_PREEMPT_BOX * BENCH_PREEMPT_BOX * 3U] __aligned(4);
+
+static K_THREAD_STACK_DEFINE(bench_preempt_stack, 1024);
+static struct k_thread bench_preempt_thread;
+static atomic_t bench_preempt_stopping;
+static uint32_t bench_preempt_frames;
+static uint64_t bench_preempt_frame_cycles;
+
+/* Full frame writes from a low priority thread, as a UI refresh. */
+static void bench_preempt_refresh(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	const struct display_buffer_descriptor *desc = p2;
+	uint32_t start;
+
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&bench_preempt_stopping) == 0) {
+		start = k_cycle_get_32();
+		display_write(dev, 0U, 0U, desc, frame);
+		bench_preempt_frame_cycles += k_cycle_get_32() - start;
+		bench_preempt_frames++;
+	}
+}
+
+void bench_preempt(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	struct display_buffer_descriptor frame_desc;
+	struct display_buffer_descriptor box_desc;
+	uint64_t total_cycles = 0U;
+	uint32_t max_cycles = 0U;
+	uint32_t cycles;
+	uint32_t start;
+	size_t bpp;
+
+	display_get_capabilities(dev, &capabilities);
+	bpp = (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+
+	frame_desc.width = capabilities.x_resolution;
+	frame_desc.pitch = capabilities.x_resolution;
+	frame_desc.height = MIN(capabilities.y_resolution,
+				sizeof(frame) / (capabilities.x_resolution * bpp));
+	frame_desc.buf_size = frame_desc.width * frame_desc.height * bpp;
+
+	box_desc.width = BENCH_PREEMPT_BOX;
+	box_desc.height = BENCH_PREEMPT_BOX;
+	box_desc.pitch = BENCH_PREEMPT_BOX;
+	box_desc.buf_size = BENCH_PREEMPT_BOX * BENCH_PREEMPT_BOX * bpp;
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	struct display_buffer_descriptor chunk_desc = frame_desc;
+	struct ili9163c_write_stats stats;
+	uint32_t chunk_cycles;
+
+	/* Reference: the bus time of one chunk, the bound of the urgent write wait. */
+	chunk_desc.height = MIN(frame_desc.height, CONFIG_ILI9163C_WRITE_CHUNK_ROWS);
+	start = k_cycle_get_32();
+	display_write(dev, 0U, 0U, &chunk_desc, frame);
+	chunk_cycles = k_cycle_get_32() - start;
+
+	ili9163c_reset_write_stats(dev);
+#endif
+
+	atomic_set(&bench_preempt_stopping, 0);
+	k_thread_create(&bench_preempt_thread, bench_preempt_stack,
+			K_THREAD_STACK_SIZEOF(bench_preempt_stack), bench_preempt_refresh,
+			(void *)dev, &frame_desc, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+			K_NO_WAIT);
+
+	/* Small updates at irregular intervals, as a cursor following a touch. */
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		k_usleep(1000 + (k_cycle_get_32() % 4000U));
+
+		start = k_cycle_get_32();
+		display_write(dev, 8U, 8U, &box_desc, box);
+		cycles = k_cycle_get_32() - start;
+
+		total_cycles += cycles;
+		max_cycles = MAX(max_cycles, cycles);
+	}
+
+	atomic_set(&bench_preempt_stopping, 1);
+	k_thread_join(&bench_preempt_thread, K_FOREVER);
+
+	LOG_INF("preempt: frame %u us, 16x16 latency avg %u us, max %u us",
+		k_cyc_to_us_floor32(bench_preempt_frame_cycles / MAX(bench_preempt_frames, 1U)),
+		k_cyc_to_us_floor32(total_cycles / CONFIG_SAMPLE_BENCH_ITERATIONS),
+		k_cyc_to_us_floor32(max_cycles));
+
+#ifdef CONFIG_ILI9163C_PREEMPTIBLE_WRITE
+	ili9163c_get_write_stats(dev, &stats);
+
+	LOG_INF("preempt: chunk %u us, %u chunks, %u preemptions",
+		k_cyc_to_us_floor32(chunk_cycles), stats.chunks, stats.preemptions);
+
+	for (int i = 0; i < ILI9163C_WRITE_PRIORITY_COUNT; i++) {
+		struct ili9163c_write_latency *latency = &stats.latency[i];
+
+		LOG_INF("preempt: priority %d: %u writes, latency avg %u us, max %u us", i,
+			latency->count,
+			k_cyc_to_us_floor32(latency->total_cycles / MAX(latency->count, 1U)),
+			k_cyc_to_us_floor32(latency->max_cycles));
+	}
+#endif
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_present, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_PRESENT_BOX    32U
+#define BENCH_PRESENT_LABEL  8U
+#define BENCH_PRESENT_FRAMES (CONFIG_SAMPLE_BENCH_ITERATIONS * 8)
+
+static uint8_t box[BENCH_PRESENT_BOX * BENCH_PRESENT_BOX * 3U] __aligned(4);
+
+static int bench_present_fill(const struct device *dev, uint16_t x, uint16_t y, uint16_t size,
+			      uint8_t value, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = size,
+		.height = size,
+		.pitch = size,
+		.buf_size = size * size * bpp,
+	};
+
+	memset(box, value, desc.buf_size);
+
+	return display_write(dev, x, y, &desc, box);
+}
+
+/*
+ * Application frames at irregular intervals: erase the box, draw it at its new
+ * position and draw a label over it. Returns the cycles spent in display_write().
+ */
+static uint64_t bench_present_app(const struct device *dev,
+				  const struct display_capabilities *capabilities, size_t bpp,
+				  uint64_t *pixels)
+{
+	uint16_t range_x = capabilities->x_resolution - BENCH_PRESENT_BOX;
+	uint16_t range_y = capabilities->y_resolution - BENCH_PRESENT_BOX;
+	uint64_t cycles = 0U;
+	uint16_t x = 0U;
+	uint16_t y = 0U;
+	uint32_t start;
+
+	*pixels = 0U;
+
+	for (int i = 0; i < BENCH_PRESENT_FRAMES; i++) {
+		start = k_cycle_get_32();
+		bench_present_fill(dev, x, y, BENCH_PRESENT_BOX, 0x00U, bpp);
+		x = (i * 3) % range_x;
+		y = (i * 2) % range_y;
+		bench_present_fill(dev, x, y, BENCH_PRESENT_BOX, 0x5AU + i, bpp);
+		bench_present_fill(dev, x, y, BENCH_PRESENT_LABEL, 0xFFU, bpp);
+		cycles += k_cycle_get_32() - start;
+
+		*pixels += 2U * BENCH_PRESENT_BOX * BENCH_PRESENT_BOX +
+			   BENCH_PRESENT_LABEL * BENCH_PRESENT_LABEL;
+
+		/* Rendering the next frame takes 1 to 8 ms. */
+		k_busy_wait(1000U + (i * 7919U) % 7000U);
+	}
+
+	return cycles;
+}
+
+static void bench_present_run(const struct device *dev,
+			      const struct display_capabilities *capabilities, size_t bpp,
+			      uint16_t rate_hz)
+{
+	struct ili9163c_present_stats stats;
+	uint64_t pixels;
+	uint64_t cycles;
+	uint32_t frames;
+	int r;
+
+	r = ili9163c_present_start(dev, rate_hz);
+	if (r < 0) {
+		LOG_ERR("Could not start presenting (%d)", r);
+		return;
+	}
+
+	/* The shadow framebuffer is only kept up to date while presenting. */
+	for (uint16_t y = 0U; y < capabilities->y_resolution; y += BENCH_PRESENT_BOX) {
+		for (uint16_t x = 0U; x < capabilities->x_resolution; x += BENCH_PRESENT_BOX) {
+			bench_present_fill(dev, x, y, BENCH_PRESENT_BOX, 0x00U, bpp);
+		}
+	}
+
+	/* Leave out the redraw, sent within the first frame intervals. */
+	k_msleep(100);
+	ili9163c_reset_present_stats(dev);
+
+	cycles = bench_present_app(dev, capabilities, bpp, &pixels);
+
+	ili9163c_present_stop(dev);
+	ili9163c_get_present_stats(dev, &stats);
+	frames = MAX(stats.frames, 1U);
+
+	LOG_INF("present: %u Hz: %u us in writes per app frame, %u frames, %u idle, %u missed",
+		stats.rate_hz, k_cyc_to_us_floor32(cycles / BENCH_PRESENT_FRAMES), stats.frames,
+		stats.idle, stats.missed);
+	LOG_INF("present: %u Hz: %u of %u pixels sent, transfer %u us (max %u), slack %u us "
+		"(min %u) of %u us",
+		stats.rate_hz, (uint32_t)stats.sent_pixels, (uint32_t)stats.submitted_pixels,
+		k_cyc_to_us_floor32(stats.transfer_cycles / frames),
+		k_cyc_to_us_floor32(stats.max_transfer_cycles),
+		k_cyc_to_us_floor32(stats.slack_cycles / frames),
+		k_cyc_to_us_floor32((stats.frames > 0U) ? stats.min_slack_cycles : 0U),
+		k_cyc_to_us_floor32(stats.period_cycles));
+}
+
+void bench_present(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	uint64_t pixels;
+	uint64_t cycles;
+	size_t bpp;
+
+	display_get_capabilities(dev, &capabilities);
+	bpp = (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+
+	cycles = bench_present_app(dev, &capabilities, bpp, &pixels);
+
+	LOG_INF("present: direct: %u us in writes per app frame, %u pixels sent",
+		k_cyc_to_us_floor32(cycles / BENCH_PRESENT_FRAMES), (uint32_t)pixels);
+
+	bench_present_run(dev, &capabilities, bpp, CONFIG_SAMPLE_BENCH_PRESENT_RATE_HZ);
+	bench_present_run(dev, &capabilities, bpp, 0U);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/drivers/display/ili9163c_emul.h>
+#include <zephyr/drivers/emul.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_resync, CONFIG_LOG_DEFAULT_LEVEL);
+
+static const struct emul *emul = EMUL_DT_GET(DT_NODELABEL(ili9163c_emul));
+
+static const struct {
+	enum ili9163c_emul_fault fault;
+	const char *name;
+} faults[] = {
+	{ILI9163C_EMUL_FAULT_MADCTL, "MADCTL"},
+	{ILI9163C_EMUL_FAULT_PIXSET, "PIXSET"},
+	{ILI9163C_EMUL_FAULT_INVERSION, "inversion"},
+	{ILI9163C_EMUL_FAULT_DISPLAY_OFF, "display off"},
+	{ILI9163C_EMUL_FAULT_RESET, "reset"},
+};
+
+static bool state_equal(const struct ili9163c_emul_state *a, const struct ili9163c_emul_state *b)
+{
+	return (a->madctl == b->madctl) && (a->pixset == b->pixset) &&
+	       (a->inversion == b->inversion) && (a->display_on == b->display_on) &&
+	       (a->sleep_out == b->sleep_out);
+}
+
+void bench_resync(const struct device *dev)
+{
+	struct ili9163c_resync_stats stats;
+	struct ili9163c_emul_state expected;
+	struct ili9163c_emul_state state;
+	uint64_t check_cycles = 0U;
+	int r;
+
+	ili9163c_emul_get_state(emul, &expected);
+
+	/* Detection overhead: status checks of a healthy controller. */
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		r = ili9163c_resync(dev);
+		if (r != 0) {
+			LOG_ERR("Unexpected resync result (%d)", r);
+			return;
+		}
+
+		ili9163c_get_resync_stats(dev, &stats);
+		check_cycles += stats.check_cycles;
+	}
+
+	LOG_INF("resync: check %u us",
+		k_cyc_to_us_floor32((uint32_t)(check_cycles / CONFIG_SAMPLE_BENCH_ITERATIONS)));
+
+	for (size_t i = 0U; i < ARRAY_SIZE(faults); i++) {
+		ili9163c_emul_inject_fault(emul, faults[i].fault);
+
+		r = ili9163c_resync(dev);
+		if (r < 0) {
+			LOG_ERR("resync: %s: failed (%d)", faults[i].name, r);
+			continue;
+		}
+
+		ili9163c_get_resync_stats(dev, &stats);
+		ili9163c_emul_get_state(emul, &state);
+
+		LOG_INF("resync: %s: diverged 0x%02x, recovery %u us, %s", faults[i].name, r,
+			k_cyc_to_us_floor32(stats.recovery_cycles),
+			state_equal(&state, &expected) ? "restored" : "NOT restored");
+	}
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_rgb444, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_RGB444_ROWS 16U
+#define BENCH_RGB444_HOR_MAX                                                                       \
+	MAX(DT_PROP(DT_CHOSEN(zephyr_display), width), DT_PROP(DT_CHOSEN(zephyr_display), height))
+
+static uint8_t buf[BENCH_RGB444_HOR_MAX * BENCH_RGB444_ROWS * 3U] __aligned(4);
+
+static void bench_rgb444_color(uint16_t x, uint16_t y, uint8_t rgb[3])
+{
+	rgb[0] = x * 17U;
+	rgb[1] = y * 13U;
+	rgb[2] = (x ^ y) * 29U;
+}
+
+/* Fill the buffer with the color of each screen pixel, in the input pixel format. */
+static void bench_rgb444_fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+			      uint16_t pitch, size_t bpp)
+{
+	uint8_t rgb[3];
+	uint8_t *px;
+
+	for (uint16_t row = 0U; row < height; row++) {
+		for (uint16_t col = 0U; col < pitch; col++) {
+			bench_rgb444_color(x + col, y + row, rgb);
+			px = &buf[(row * pitch + col) * bpp];
+
+			if (bpp == 2U) {
+				sys_put_be16(((rgb[0] & 0xF8U) << 8) | ((rgb[1] & 0xFCU) << 3) |
+						     (rgb[2] >> 3),
+					     px);
+			} else {
+				px[0] = rgb[0];
+				px[1] = rgb[1];
+				px[2] = rgb[2];
+			}
+		}
+	}
+}
+
+/* Cycles to write a full frame in bands. */
+static uint32_t bench_rgb444_frame(const struct device *dev,
+				   const struct display_capabilities *capabilities, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = capabilities->x_resolution,
+		.pitch = capabilities->x_resolution,
+	};
+	uint64_t cycles = 0U;
+	uint32_t start;
+
+	bench_rgb444_fill(0U, 0U, desc.width, BENCH_RGB444_ROWS, desc.pitch, bpp);
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+
+		for (uint16_t y = 0U; y < capabilities->y_resolution; y += BENCH_RGB444_ROWS) {
+			desc.height = MIN(BENCH_RGB444_ROWS, capabilities->y_resolution - y);
+			desc.buf_size = desc.pitch * desc.height * bpp;
+			display_write(dev, 0U, y, &desc, buf);
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return (uint32_t)(cycles / CONFIG_SAMPLE_BENCH_ITERATIONS);
+}
+
+static void bench_rgb444_run(const struct device *dev, enum display_pixel_format pixel_format,
+			     const char *name)
+{
+	struct display_capabilities capabilities;
+	size_t bpp = (pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+	uint32_t direct_cycles;
+	uint32_t packed_cycles;
+	uint32_t direct_bytes;
+	uint32_t packed_bytes;
+	uint32_t pixels;
+
+	if (display_set_pixel_format(dev, pixel_format) < 0) {
+		LOG_INF("rgb444: %s input not supported", name);
+		return;
+	}
+
+	display_get_capabilities(dev, &capabilities);
+	pixels = capabilities.x_resolution * capabilities.y_resolution;
+	direct_bytes = pixels * bpp;
+	packed_bytes = (pixels * 3U + 1U) / 2U;
+
+	if (ili9163c_set_rgb444(dev, false) == 0) {
+		direct_cycles = bench_rgb444_frame(dev, &capabilities, bpp);
+		LOG_INF("rgb444: %s: frame %u us, %u bytes", name,
+			k_cyc_to_us_floor32(direct_cycles), direct_bytes);
+	}
+
+	if (ili9163c_set_rgb444(dev, true) < 0) {
+		LOG_INF("rgb444: %s: RGB444 mode not supported", name);
+		return;
+	}
+
+	packed_cycles = bench_rgb444_frame(dev, &capabilities, bpp);
+	LOG_INF("rgb444: %s packed to RGB444: frame %u us, %u bytes (-%u%%)", name,
+		k_cyc_to_us_floor32(packed_cycles), packed_bytes,
+		100U - packed_bytes * 100U / direct_bytes);
+}
+
+void bench_rgb444(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	bool rgb444 = ili9163c_get_rgb444(dev);
+
+	display_get_capabilities(dev, &capabilities);
+
+	bench_rgb444_run(dev, PIXEL_FORMAT_RGB_565, "RGB565");
+	bench_rgb444_run(dev, PIXEL_FORMAT_RGB_888, "RGB888");
+
+	display_set_pixel_format(dev, capabilities.current_pixel_format);
+	ili9163c_set_rgb444(dev, rgb444);
+}
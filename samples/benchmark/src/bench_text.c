@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/display/ili9163c_text.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_text, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_TEXT_FG 0xFFFFFFU
+#define BENCH_TEXT_BG 0x102040U
+
+static uint8_t glyph_buf[16U * 16U * 3U] __aligned(4);
+
+/*
+ * Reference: each glyph is blended into a buffer in the display pixel format,
+ * then written on its own.
+ */
+static int bench_text_baseline(const struct device *dev, const struct ili9163c_text_style *style,
+			       enum display_pixel_format format, uint16_t x, uint16_t y,
+			       const char *text)
+{
+	const struct ili9163c_font *font = style->font;
+	size_t stride = DIV_ROUND_UP(font->width * font->bpp, 8U);
+	uint8_t levels = BIT(font->bpp) - 1U;
+	struct display_buffer_descriptor desc = {
+		.width = font->width,
+		.height = font->height,
+		.pitch = font->width,
+		.buf_size = sizeof(glyph_buf),
+	};
+	const uint8_t *src;
+	uint8_t *dst;
+	uint8_t level;
+	uint32_t rgb;
+	size_t bit;
+	int r;
+
+	for (; *text != '\0'; text++, x += font->width) {
+		src = &font->glyphs[(*text - font->first) * stride * font->height];
+		dst = glyph_buf;
+
+		for (uint8_t row = 0U; row < font->height; row++) {
+			for (uint8_t col = 0U; col < font->width; col++) {
+				bit = col * font->bpp;
+				level = (src[bit / 8U] >> (8U - font->bpp - bit % 8U)) & levels;
+
+				rgb = 0U;
+				for (int shift = 0; shift < 24; shift += 8) {
+					rgb |= ((((style->bg >> shift) & 0xFFU) * (levels - level) +
+						 ((style->fg >> shift) & 0xFFU) * level) /
+						levels)
+					       << shift;
+				}
+
+				if (format == PIXEL_FORMAT_RGB_565) {
+					sys_put_be16(((rgb >> 8) & 0xF800U) |
+							     ((rgb >> 5) & 0x07E0U) |
+							     ((rgb >> 3) & 0x001FU),
+						     dst);
+					dst += 2;
+				} else {
+					sys_put_be24(rgb, dst);
+					dst += 3;
+				}
+			}
+			src += stride;
+		}
+
+		r = display_write(dev, x, y, &desc, glyph_buf);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+
+/* Draw a status screen CONFIG_SAMPLE_BENCH_ITERATIONS times, return the characters per second. */
+static uint32_t bench_text_screen(const struct device *dev, const struct ili9163c_text_style *style,
+				  bool baseline)
+{
+	const struct ili9163c_font *font = style->font;
+	struct display_capabilities capabilities;
+	uint64_t cycles = 0U;
+	uint32_t chars = 0U;
+	char line[24];
+	uint32_t start;
+	size_t size;
+
+	display_get_capabilities(dev, &capabilities);
+
+	/* Lines are cut to the display width. */
+	size = MIN(sizeof(line), capabilities.x_resolution / font->width + 1U);
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		for (uint16_t y = 0U; y + font->height <= capabilities.y_resolution;
+		     y += font->height) {
+			snprintk(line, size, "CH%u %4u mV OK", y / font->height,
+				 (i * 37U + y * 11U) % 5000U);
+
+			start = k_cycle_get_32();
+			if (baseline) {
+				bench_text_baseline(dev, style, capabilities.current_pixel_format,
+						    0U, y, line);
+			} else {
+				ili9163c_text_draw(dev, style, 0U, y, line);
+			}
+			cycles += k_cycle_get_32() - start;
+
+			chars += strlen(line);
+		}
+	}
+
+	return (uint32_t)((uint64_t)chars * USEC_PER_SEC / MAX(k_cyc_to_us_floor64(cycles), 1U));
+}
+
+void bench_text(const struct device *dev)
+{
+	static const struct {
+		const char *name;
+		const struct ili9163c_font *font;
+	} fonts[] = {
+		{"1 bpp", &ili9163c_font_mono_8x16},
+		{"4 bpp", &ili9163c_font_mono_8x16_aa},
+	};
+	struct ili9163c_text_style style = {.fg = BENCH_TEXT_FG, .bg = BENCH_TEXT_BG};
+	struct ili9163c_text_stats before;
+	struct ili9163c_text_stats after;
+	uint32_t baseline;
+	uint32_t cached;
+
+	for (size_t i = 0U; i < ARRAY_SIZE(fonts); i++) {
+		style.font = fonts[i].font;
+
+		baseline = bench_text_screen(dev, &style, true);
+
+		ili9163c_text_get_stats(&before);
+		cached = bench_text_screen(dev, &style, false);
+		ili9163c_text_get_stats(&after);
+
+		LOG_INF("text: %s: per glyph %u chars/s, cached %u chars/s, %u misses, %u chars "
+			"per write",
+			fonts[i].name, baseline, cached, after.misses - before.misses,
+			(after.chars - before.chars) / MAX(after.writes - before.writes, 1U));
+	}
+}
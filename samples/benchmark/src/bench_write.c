@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bench_write, CONFIG_LOG_DEFAULT_LEVEL);
+
+#define BENCH_WRITE_ROWS 16U
+#define BENCH_WRITE_HOR_MAX                                                                        \
+	MAX(DT_PROP(DT_CHOSEN(zephyr_display), width), DT_PROP(DT_CHOSEN(zephyr_display), height))
+
+static uint8_t buf[BENCH_WRITE_HOR_MAX * BENCH_WRITE_ROWS * 3U] __aligned(4);
+
+static uint32_t bench_write_cycles(const struct device *dev, uint16_t x, uint16_t y,
+				   const struct display_buffer_descriptor *desc)
+{
+	uint64_t cycles = 0U;
+	uint32_t start;
+
+	for (int i = 0; i < CONFIG_SAMPLE_BENCH_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+		display_write(dev, x, y, desc, buf);
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return (uint32_t)(cycles / CONFIG_SAMPLE_BENCH_ITERATIONS);
+}
+
+static void bench_write_report(const char *name, uint32_t cycles)
+{
+	LOG_INF("write: %s: %u cycles (%u us)", name, cycles, k_cyc_to_us_floor32(cycles));
+}
+
+void bench_write(const struct device *dev)
+{
+	struct display_capabilities capabilities;
+	struct display_buffer_descriptor desc;
+	uint32_t frame_cycles = 0U;
+	size_t bpp;
+
+	display_get_capabilities(dev, &capabilities);
+	bpp = (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+
+	for (size_t i = 0U; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+
+	desc.width = 16U;
+	desc.height = 16U;
+	desc.pitch = 16U;
+	desc.buf_size = 16U * 16U * bpp;
+	bench_write_report("16x16", bench_write_cycles(dev, 0U, 0U, &desc));
+
+	desc.width = capabilities.x_resolution / 2U;
+	desc.height = BENCH_WRITE_ROWS;
+	desc.pitch = capabilities.x_resolution;
+	desc.buf_size = capabilities.x_resolution * BENCH_WRITE_ROWS * bpp;
+	bench_write_report("half band, strided", bench_write_cycles(dev, 0U, 0U, &desc));
+
+	desc.width = capabilities.x_resolution;
+	bench_write_report("band", bench_write_cycles(dev, 0U, 0U, &desc));
+
+	for (uint16_t y = 0U; y < capabilities.y_resolution; y += BENCH_WRITE_ROWS) {
+		desc.height = MIN(BENCH_WRITE_ROWS, capabilities.y_resolution - y);
+		frame_cycles += bench_write_cycles(dev, 0U, y, &desc);
+	}
+
+	bench_write_report("frame", frame_cycles);
+
+#ifdef CONFIG_ILI9163C_BUF_POOL
+	struct ili9163c_buf_stats stats;
+
+	ili9163c_buf_get_stats(&stats);
+	LOG_INF("write: bounce buffers: %u of %u bytes, high watermark %u, %u failures",
+		stats.count, stats.size, stats.high_watermark, stats.failures);
+#endif
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include "bench.h"
+
+#define LOG_LEVEL CONFIG_LOG_DEFAULT_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(app);
+
+static const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+int main(void)
+{
+	if (!device_is_ready(display_dev)) {
+		LOG_ERR("Device not ready, aborting benchmark");
+		return 0;
+	}
+
+	LOG_INF("Benchmark for %s", display_dev->name);
+
+#ifdef CONFIG_SAMPLE_BENCH_WRITE
+	bench_write(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_RESYNC
+	bench_resync(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_MIRROR
+	bench_mirror(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_PREEMPT
+	bench_preempt(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_BANDS
+	bench_bands(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_TEXT
+	bench_text(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_COMPOSE
+	bench_compose(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_PRESENT
+	bench_present(display_dev);
+#endif
+
+#ifdef CONFIG_SAMPLE_BENCH_RGB444
+	bench_rgb444(display_dev);
+#endif
+
+	LOG_INF("Benchmark done");
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "lvgl_ili9163c.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lvgl_ili9163c, CONFIG_LOG_DEFAULT_LEVEL);
+
+BUILD_ASSERT(IS_ENABLED(CONFIG_LV_COLOR_DEPTH_16), "ILI9163C LVGL glue requires RGB565");
+BUILD_ASSERT(IS_ENABLED(CONFIG_LV_COLOR_16_SWAP), "ILI9163C expects big endian RGB565");
+
+#define LVGL_ILI9163C_NODE DT_CHOSEN(zephyr_display)
+#define LVGL_ILI9163C_HOR_MAX                                                                      \
+	MAX(DT_PROP(LVGL_ILI9163C_NODE, width), DT_PROP(LVGL_ILI9163C_NODE, height))
+#define LVGL_ILI9163C_BUF_PIXELS (LVGL_ILI9163C_HOR_MAX * CONFIG_SAMPLE_LVGL_BUF_ROWS)
+
+/* The flush thread must preempt rendering as soon as an area is queued. */
+#define LVGL_ILI9163C_FLUSH_PRIORITY K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1)
+
+struct lvgl_ili9163c_flush {
+	lv_disp_drv_t *disp_drv;
+	lv_area_t area;
+	const lv_color_t *pixels;
+};
+
+static lv_color_t lvgl_ili9163c_buf0[LVGL_ILI9163C_BUF_PIXELS] __aligned(4);
+static lv_color_t lvgl_ili9163c_buf1[LVGL_ILI9163C_BUF_PIXELS] __aligned(4);
+static lv_disp_draw_buf_t lvgl_ili9163c_draw_buf;
+static lv_disp_drv_t lvgl_ili9163c_disp_drv;
+static const struct device *lvgl_ili9163c_dev;
+
+/* One request per draw buffer can be in flight. */
+K_MSGQ_DEFINE(lvgl_ili9163c_msgq, sizeof(struct lvgl_ili9163c_flush), 2, 4);
+K_SEM_DEFINE(lvgl_ili9163c_done, 0, 1);
+
+static void lvgl_ili9163c_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area,
+				   lv_color_t *color_p)
+{
+	struct lvgl_ili9163c_flush req = {
+		.disp_drv = disp_drv,
+		.area = *area,
+		.pixels = color_p,
+	};
+
+	/* Never blocks: LVGL waits for flush_ready before reusing a buffer. */
+	if (k_msgq_put(&lvgl_ili9163c_msgq, &req, K_NO_WAIT) < 0) {
+		LOG_ERR("Flush queue full");
+		lv_disp_flush_ready(disp_drv);
+	}
+}
+
+static void lvgl_ili9163c_wait_cb(lv_disp_drv_t *disp_drv)
+{
+	ARG_UNUSED(disp_drv);
+
+	/* Sleep instead of spinning while both draw buffers are on the bus. */
+	k_sem_take(&lvgl_ili9163c_done, K_FOREVER);
+}
+
+static void lvgl_ili9163c_flush_thread(void *p1, void *p2, void *p3)
+{
+	struct display_buffer_descriptor desc;
+	struct lvgl_ili9163c_flush req;
+	uint16_t w;
+	uint16_t h;
+	int r;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msgq_get(&lvgl_ili9163c_msgq, &req, K_FOREVER);
+
+		w = lv_area_get_width(&req.area);
+		h = lv_area_get_height(&req.area);
+
+		desc.width = w;
+		desc.height = h;
+		desc.pitch = w;
+		desc.buf_size = w * h * sizeof(lv_color_t);
+
+		r = display_write(lvgl_ili9163c_dev, req.area.x1, req.area.y1, &desc, req.pixels);
+		if (r < 0) {
+			LOG_ERR("Could not write area (%d)", r);
+		}
+
+		lv_disp_flush_ready(req.disp_drv);
+		k_sem_give(&lvgl_ili9163c_done);
+	}
+}
+
+K_THREAD_DEFINE(lvgl_ili9163c_flush_tid, CONFIG_SAMPLE_LVGL_FLUSH_STACK_SIZE,
+		lvgl_ili9163c_flush_thread, NULL, NULL, NULL, LVGL_ILI9163C_FLUSH_PRIORITY, 0, 0);
+
+int lvgl_ili9163c_init(const struct device *dev,
+		       void (*monitor_cb)(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px))
+{
+	struct display_capabilities capabilities;
+	lv_disp_t *disp = lv_disp_get_default();
+
+	if (!device_is_ready(dev) || (disp == NULL)) {
+		return -ENODEV;
+	}
+
+	display_get_capabilities(dev, &capabilities);
+	if (capabilities.current_pixel_format != PIXEL_FORMAT_RGB_565) {
+		LOG_ERR("Display must be configured in RGB565");
+		return -ENOTSUP;
+	}
+
+	lvgl_ili9163c_dev = dev;
+
+	lv_disp_draw_buf_init(&lvgl_ili9163c_draw_buf, lvgl_ili9163c_buf0, lvgl_ili9163c_buf1,
+			      capabilities.x_resolution * CONFIG_SAMPLE_LVGL_BUF_ROWS);
+
+	lv_disp_drv_init(&lvgl_ili9163c_disp_drv);
+	lvgl_ili9163c_disp_drv.hor_res = capabilities.x_resolution;
+	lvgl_ili9163c_disp_drv.ver_res = capabilities.y_resolution;
+	lvgl_ili9163c_disp_drv.draw_buf = &lvgl_ili9163c_draw_buf;
+	lvgl_ili9163c_disp_drv.flush_cb = lvgl_ili9163c_flush_cb;
+	lvgl_ili9163c_disp_drv.wait_cb = lvgl_ili9163c_wait_cb;
+	lvgl_ili9163c_disp_drv.monitor_cb = monitor_cb;
+
+	lv_disp_drv_update(disp, &lvgl_ili9163c_disp_drv);
+
+	return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LVGL_ILI9163C_H_
+#define LVGL_ILI9163C_H_
+
+#include <zephyr/device.h>
+
+#include <lvgl.h>
+
+/**
+ * @brief Attach LVGL to an ILI9163C display with asynchronous flushing.
+ *
+ * Replaces the driver of the default LVGL display by one rendering into two
+ * partial draw buffers. Flushed areas are handed to a dedicated thread that
+ * writes them to the panel and reports completion with lv_disp_flush_ready(),
+ * so LVGL renders the next area while the previous one is on the bus.
+ *
+ * Pixels are written in the order LVGL renders them: CONFIG_LV_COLOR_16_SWAP
+ * must be enabled so RGB565 is produced big endian, as the panel expects.
+ *
+ * @param dev ILI9163C display device, configured in RGB565.
+ * @param monitor_cb Optional callback invoked after every refreshed frame.
+ *
+ * @retval 0 on success.
+ * @retval -ENODEV if the display or the default LVGL display is not ready.
+ * @retval -ENOTSUP if the display is not in RGB565.
+ */
+int lvgl_ili9163c_init(const struct device *dev,
+		       void (*monitor_cb)(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px));
+
+#endif /* LVGL_ILI9163C_H_ */
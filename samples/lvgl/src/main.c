@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <lvgl.h>
+
+#include "lvgl_ili9163c.h"
+
+#define LOG_LEVEL CONFIG_LOG_DEFAULT_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(app);
+
+static const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+static uint32_t frame_count;
+static uint32_t frame_pixels;
+
+static void monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
+{
+	ARG_UNUSED(disp_drv);
+	ARG_UNUSED(time);
+
+	frame_count++;
+	frame_pixels += px;
+}
+
+static void anim_x_cb(void *obj, int32_t value)
+{
+	lv_obj_set_x(obj, value);
+}
+
+static void anim_arc_cb(void *obj, int32_t value)
+{
+	lv_arc_set_value(obj, value);
+}
+
+static void anim_bar_cb(void *obj, int32_t value)
+{
+	lv_bar_set_value(obj, value, LV_ANIM_OFF);
+}
+
+static void start_anim(lv_obj_t *obj, lv_anim_exec_xcb_t exec_cb, int32_t start, int32_t end,
+		       uint32_t time)
+{
+	lv_anim_t anim;
+
+	lv_anim_init(&anim);
+	lv_anim_set_var(&anim, obj);
+	lv_anim_set_exec_cb(&anim, exec_cb);
+	lv_anim_set_values(&anim, start, end);
+	lv_anim_set_time(&anim, time);
+	lv_anim_set_playback_time(&anim, time);
+	lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
+	lv_anim_start(&anim);
+}
+
+static lv_obj_t *create_scene(void)
+{
+	lv_obj_t *screen = lv_scr_act();
+	lv_obj_t *label;
+	lv_obj_t *box;
+	lv_obj_t *arc;
+	lv_obj_t *bar;
+
+	lv_obj_set_style_bg_color(screen, lv_color_hex(0x585757), LV_PART_MAIN);
+
+	box = lv_obj_create(screen);
+	lv_obj_set_size(box, 32, 32);
+	lv_obj_set_y(box, 8);
+	lv_obj_set_style_bg_color(box, lv_color_hex(0xF18700), LV_PART_MAIN);
+	start_anim(box, anim_x_cb, 0, lv_disp_get_hor_res(NULL) - 32, 1000);
+
+	arc = lv_arc_create(screen);
+	lv_obj_set_size(arc, 64, 64);
+	lv_obj_align(arc, LV_ALIGN_CENTER, 0, 0);
+	start_anim(arc, anim_arc_cb, 0, 100, 1500);
+
+	bar = lv_bar_create(screen);
+	lv_obj_set_size(bar, lv_disp_get_hor_res(NULL) - 16, 10);
+	lv_obj_align(bar, LV_ALIGN_BOTTOM_MID, 0, -24);
+	lv_obj_set_style_bg_color(bar, lv_color_hex(0xa2c857), LV_PART_INDICATOR);
+	start_anim(bar, anim_bar_cb, 0, 100, 2000);
+
+	label = lv_label_create(screen);
+	lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -4);
+	lv_obj_set_style_text_color(label, lv_color_hex(0x00b0eb), LV_PART_MAIN);
+	lv_label_set_text(label, "");
+
+	return label;
+}
+
+static void report(lv_obj_t *label)
+{
+	static k_thread_runtime_stats_t last_stats;
+	static int64_t last_time;
+	static uint32_t last_frames;
+	static uint32_t last_pixels;
+	k_thread_runtime_stats_t stats;
+	uint64_t idle_cycles;
+	uint64_t all_cycles;
+	uint32_t fps_x10;
+	uint32_t idle_pct = 0U;
+	int64_t now = k_uptime_get();
+
+	if (k_thread_runtime_stats_all_get(&stats) < 0) {
+		return;
+	}
+
+	idle_cycles = stats.idle_cycles - last_stats.idle_cycles;
+	all_cycles = stats.execution_cycles - last_stats.execution_cycles;
+	if (all_cycles > 0U) {
+		idle_pct = (uint32_t)(idle_cycles * 100U / all_cycles);
+	}
+
+	fps_x10 = (frame_count - last_frames) * 10000U / (uint32_t)MAX(now - last_time, 1);
+
+	LOG_INF("FPS: %u.%u, CPU idle: %u%%, pixels: %u", fps_x10 / 10U, fps_x10 % 10U, idle_pct,
+		frame_pixels - last_pixels);
+	lv_label_set_text_fmt(label, "%u.%u FPS %u%% idle", fps_x10 / 10U, fps_x10 % 10U,
+			      idle_pct);
+
+	last_stats = stats;
+	last_time = now;
+	last_frames = frame_count;
+	last_pixels = frame_pixels;
+}
+
+int main(void)
+{
+	lv_obj_t *label;
+	int64_t next_report;
+	int r;
+
+	r = lvgl_ili9163c_init(display_dev, monitor_cb);
+	if (r < 0) {
+		LOG_ERR("Could not attach LVGL to %s (%d)", display_dev->name, r);
+		return 0;
+	}
+
+	label = create_scene();
+	lv_task_handler();
+	display_blanking_off(display_dev);
+
+	next_report = k_uptime_get() + CONFIG_SAMPLE_LVGL_REPORT_PERIOD_MS;
+	while (1) {
+		k_msleep(lv_task_handler());
+
+		if (k_uptime_get() >= next_report) {
+			report(label);
+			next_report += CONFIG_SAMPLE_LVGL_REPORT_PERIOD_MS;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/display/ili9163c_player.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
+
+#define LOG_LEVEL CONFIG_LOG_DEFAULT_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(app);
+
+#define CLIP_W CONFIG_SAMPLE_PLAYER_WIDTH
+#define CLIP_H CONFIG_SAMPLE_PLAYER_HEIGHT
+
+static const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+/* One row of the clip, in the largest supported pixel format. */
+static uint8_t row[CLIP_W * 3U];
+
+static size_t fill_row(enum display_pixel_format format, uint32_t frame, uint16_t y)
+{
+	size_t bpp = (format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+
+	for (uint16_t x = 0U; x < CLIP_W; x++) {
+		/* Diagonal stripes scrolling by two pixels per frame. */
+		uint8_t v = ((x + y + 2U * frame) & 0x10U) ? 0xFFU : 0x00U;
+		uint8_t r = v & 0xF1U;
+		uint8_t g = (v & 0x87U) | (uint8_t)(y * 255U / CLIP_H);
+		uint8_t b = ~v & 0xEBU;
+
+		if (bpp == 2U) {
+			sys_put_be16(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3),
+				     &row[x * 2U]);
+		} else {
+			row[x * 3U + 0U] = r;
+			row[x * 3U + 1U] = g;
+			row[x * 3U + 2U] = b;
+		}
+	}
+
+	return CLIP_W * bpp;
+}
+
+static int generate_clip(enum display_pixel_format format)
+{
+	struct fs_file_t file;
+	ssize_t len;
+	size_t size;
+	int r;
+
+	LOG_INF("Generating %s (%u frames)", CONFIG_SAMPLE_PLAYER_PATH,
+		CONFIG_SAMPLE_PLAYER_FRAMES);
+
+	fs_unlink(CONFIG_SAMPLE_PLAYER_PATH);
+	fs_file_t_init(&file);
+	r = fs_open(&file, CONFIG_SAMPLE_PLAYER_PATH, FS_O_CREATE | FS_O_WRITE);
+	if (r < 0) {
+		return r;
+	}
+
+	for (uint32_t frame = 0U; (r == 0) && (frame < CONFIG_SAMPLE_PLAYER_FRAMES); frame++) {
+		for (uint16_t y = 0U; y < CLIP_H; y++) {
+			size = fill_row(format, frame, y);
+			len = fs_write(&file, row, size);
+			if ((len < 0) || ((size_t)len != size)) {
+				r = (len < 0) ? (int)len : -ENOSPC;
+				break;
+			}
+		}
+	}
+
+	fs_close(&file);
+
+	return r;
+}
+
+int main(void)
+{
+	struct display_capabilities capabilities;
+	struct ili9163c_player_stats stats;
+	struct fs_dirent entry;
+	size_t frame_size;
+	int r;
+
+	if (!device_is_ready(display_dev)) {
+		LOG_ERR("Device not ready, aborting sample");
+		return 0;
+	}
+
+	display_get_capabilities(display_dev, &capabilities);
+	frame_size = CLIP_W * CLIP_H *
+		     ((capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U);
+
+	if ((fs_stat(CONFIG_SAMPLE_PLAYER_PATH, &entry) < 0) ||
+	    (entry.size != frame_size * CONFIG_SAMPLE_PLAYER_FRAMES)) {
+		r = generate_clip(capabilities.current_pixel_format);
+		if (r < 0) {
+			LOG_ERR("Could not generate clip (%d)", r);
+			return 0;
+		}
+	}
+
+	const struct ili9163c_player_config config = {
+		.display = display_dev,
+		.path = CONFIG_SAMPLE_PLAYER_PATH,
+		.x = (capabilities.x_resolution - CLIP_W) / 2U,
+		.y = (capabilities.y_resolution - CLIP_H) / 2U,
+		.width = CLIP_W,
+		.height = CLIP_H,
+		.fps = CONFIG_SAMPLE_PLAYER_FPS,
+		.max_frames = CONFIG_SAMPLE_PLAYER_FRAMES * CONFIG_SAMPLE_PLAYER_LOOPS,
+		.loop = true,
+	};
+
+	display_blanking_off(display_dev);
+
+	r = ili9163c_player_play(&config, &stats);
+	if (r < 0) {
+		LOG_ERR("Playback failed (%d)", r);
+		return 0;
+	}
+
+	LOG_INF("Played %u frames at %u FPS: %u dropped, %u late, %u underruns", stats.frames,
+		CONFIG_SAMPLE_PLAYER_FPS, stats.dropped, stats.late, stats.underruns);
+	LOG_INF("Read %u us, write %u us", (uint32_t)stats.read_us, (uint32_t)stats.write_us);
+
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/sys/byteorder.h>
+
+#define LOG_LEVEL CONFIG_LOG_DEFAULT_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(app);
+
+#define BAND_ROWS 16U
+#define BOX       32U
+#define TILE      8U
+#define TILES     20U
+
+static const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+/* Large enough for a band of the widest orientation, in the largest supported pixel format. */
+static uint8_t buf[MAX(DT_PROP(DT_CHOSEN(zephyr_display), width),
+		       DT_PROP(DT_CHOSEN(zephyr_display), height)) *
+		   BAND_ROWS * 3U] __aligned(4);
+
+static void put_pixel(uint8_t *dst, size_t bpp, uint8_t r, uint8_t g, uint8_t b)
+{
+	if (bpp == 2U) {
+		sys_put_be16(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3), dst);
+	} else {
+		dst[0] = r;
+		dst[1] = g;
+		dst[2] = b;
+	}
+}
+
+/* Full screen gradient, one display write per band of rows. */
+static int draw_gradient(const struct display_capabilities *caps, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = caps->x_resolution,
+		.pitch = caps->x_resolution,
+	};
+	int r;
+
+	for (uint16_t y = 0U; y < caps->y_resolution; y += BAND_ROWS) {
+		desc.height = MIN(BAND_ROWS, caps->y_resolution - y);
+		desc.buf_size = desc.width * desc.height * bpp;
+
+		for (uint16_t row = 0U; row < desc.height; row++) {
+			for (uint16_t x = 0U; x < desc.width; x++) {
+				put_pixel(&buf[(row * desc.pitch + x) * bpp], bpp,
+					  x * 255U / caps->x_resolution,
+					  (y + row) * 255U / caps->y_resolution, 0x40U);
+			}
+		}
+
+		r = display_write(display_dev, 0U, y, &desc, buf);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+
+/* Box cut out of a wider image, so that rows are strided. */
+static int draw_box(const struct display_capabilities *caps, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = BOX,
+		.height = BOX,
+		.pitch = 2U * BOX,
+		.buf_size = 2U * BOX * BOX * bpp,
+	};
+
+	for (uint16_t y = 0U; y < BOX; y++) {
+		for (uint16_t x = 0U; x < 2U * BOX; x++) {
+			put_pixel(&buf[(y * desc.pitch + x) * bpp], bpp, 0xFFU, (x ^ y) << 3,
+				  0x00U);
+		}
+	}
+
+	return display_write(display_dev, (caps->x_resolution - BOX) / 2U,
+			     (caps->y_resolution - BOX) / 2U, &desc, buf);
+}
+
+/* Small scattered updates, as a user interface does. */
+static int draw_tiles(const struct display_capabilities *caps, size_t bpp)
+{
+	struct display_buffer_descriptor desc = {
+		.width = TILE,
+		.height = TILE,
+		.pitch = TILE,
+		.buf_size = TILE * TILE * bpp,
+	};
+	int r;
+
+	for (uint16_t i = 0U; i < TILES; i++) {
+		for (uint16_t p = 0U; p < TILE * TILE; p++) {
+			put_pixel(&buf[p * bpp], bpp, 0x00U, 0xFFU - i * 8U, i * 12U);
+		}
+
+		r = display_write(display_dev, (i * 37U) % (caps->x_resolution - TILE),
+				  (i * 53U) % (caps->y_resolution - TILE), &desc, buf);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+
+static int run_workload(void)
+{
+	struct display_capabilities caps;
+	size_t bpp;
+	int r;
+
+	display_get_capabilities(display_dev, &caps);
+	bpp = (caps.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+
+	r = display_blanking_off(display_dev);
+	if (r < 0) {
+		return r;
+	}
+
+	r = draw_gradient(&caps, bpp);
+	if (r < 0) {
+		return r;
+	}
+
+	r = draw_box(&caps, bpp);
+	if (r < 0) {
+		return r;
+	}
+
+	r = draw_tiles(&caps, bpp);
+	if (r < 0) {
+		return r;
+	}
+
+	/* The same tiles in landscape, then back to the initial orientation. */
+	r = display_set_orientation(display_dev, DISPLAY_ORIENTATION_ROTATED_90);
+	if (r < 0) {
+		return r;
+	}
+
+	display_get_capabilities(display_dev, &caps);
+	r = draw_tiles(&caps, bpp);
+	if (r < 0) {
+		return r;
+	}
+
+	return display_set_orientation(display_dev, DISPLAY_ORIENTATION_NORMAL);
+}
+
+int main(void)
+{
+	struct ili9163c_record_stats stats;
+	int r;
+
+	if (!device_is_ready(display_dev)) {
+		LOG_ERR("Device not ready, aborting sample");
+		return 0;
+	}
+
+	r = ili9163c_record_start(display_dev, ili9163c_record_console_sink, NULL);
+	if (r < 0) {
+		LOG_ERR("Could not start recording (%d)", r);
+		return 0;
+	}
+
+	r = run_workload();
+	if (r < 0) {
+		LOG_ERR("Workload failed (%d)", r);
+	}
+
+	r = ili9163c_record_stop(display_dev);
+	if (r < 0) {
+		LOG_ERR("Recording failed (%d)", r);
+	}
+
+	ili9163c_get_record_stats(display_dev, &stats);
+
+	LOG_INF("Recorded %u commands (%u bytes), %u data writes (%u bytes), %u reads",
+		stats.commands, (uint32_t)stats.command_bytes, stats.writes,
+		(uint32_t)stats.data_bytes, stats.reads);
+	LOG_INF("Recording done, %u bytes", (uint32_t)stats.stream_bytes);
+
+	return 0;
+}
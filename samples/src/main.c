@@ -6,6 +6,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/pwm.h>
 #include <stdio.h>
@@ -200,7 +201,7 @@ static int initialize_display(const struct device **display_dev,
 
 static int allocate_buffer(uint8_t **buf, size_t buf_size)
 {
-	*buf = k_malloc(buf_size);
+	*buf = ili9163c_buf_acquire(buf_size);
 	if (*buf == NULL) {
 		LOG_ERR("Could not allocate memory. Aborting sample.");
 		return -ENOMEM;
@@ -210,10 +211,12 @@ static int allocate_buffer(uint8_t **buf, size_t buf_size)
 }
 
 static void fill_display(const struct device *display_dev,
-			 struct display_capabilities *capabilities, uint8_t *buf, size_t buf_size,
-			 fill_buffer fill_buffer_fnc)
+			 struct display_capabilities *capabilities)
 {
 	struct display_buffer_descriptor buf_desc;
+	fill_buffer fill_buffer_fnc;
+	uint8_t *buf;
+	size_t buf_size;
 	size_t rect_w, rect_h, h_step, scale;
 	uint8_t bg_color;
 	size_t x, y, grey_count;
@@ -290,6 +293,10 @@ static void fill_display(const struct device *display_dev,
 		return;
 	}
 
+	if (allocate_buffer(&buf, buf_size) < 0) {
+		return;
+	}
+
 	(void)memset(buf, bg_color, buf_size);
 
 	buf_desc.buf_size = buf_size;
@@ -330,14 +337,12 @@ static void fill_display(const struct device *display_dev,
 	y = capabilities->y_resolution - rect_h;
 	fill_buffer_fnc(BOTTOM_LEFT, grey_count, buf, buf_size);
 	display_write(display_dev, x, y, &buf_desc, buf);
+
+	ili9163c_buf_release(buf);
 }
 
 int main(void)
 {
-	uint8_t *buf;
-	size_t buf_size = 0;
-	fill_buffer fill_buffer_fnc = NULL;
-
 	if (initialize_display(&display_dev, &capabilities) < 0) {
 		return 0;
 	}
@@ -349,11 +354,7 @@ int main(void)
 		return 0;
 	}
 
-	if (allocate_buffer(&buf, buf_size) < 0) {
-		return 0;
-	}
-
-	fill_display(display_dev, &capabilities, buf, buf_size, fill_buffer_fnc);
+	fill_display(display_dev, &capabilities);
 
 	while (1) {
 		if (blinking) {
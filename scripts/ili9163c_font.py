@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024, CATIE
+# SPDX-License-Identifier: Apache-2.0
+
+"""Convert a monospaced TrueType font to an ili9163c_text font (requires Pillow).
+
+Characters from --first to --last are rendered into cells of --width x
+--height pixels, 1 bit per pixel or 4 bits per pixel anti-aliased, and
+written as a C source defining a struct ili9163c_font, see
+include/zephyr/display/ili9163c_text.h for the glyph layout.
+
+Example:
+
+    ili9163c_font.py DejaVuSansMono.ttf --size 13 --width 8 --height 16 --bpp 4 \\
+        --name ili9163c_font_mono_8x16_aa -o ili9163c_font_mono_8x16_aa.c
+"""
+
+import argparse
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def render(font, char, width, height, bpp, y_offset):
+    image = Image.new("L", (width, height), 0)
+    draw = ImageDraw.Draw(image)
+    if bpp == 1:
+        draw.fontmode = "1"
+    x = (width - round(font.getlength(char))) // 2
+    draw.text((x, y_offset), char, font=font, fill=255)
+
+    if bpp == 1:
+        return [1 if v >= 128 else 0 for v in image.tobytes()]
+    return [(v * 15 + 127) // 255 for v in image.tobytes()]
+
+
+def pack(levels, width, height, bpp):
+    """Pack rows MSB first, each row starting on a byte boundary."""
+    data = []
+    for row in range(height):
+        bits = 0
+        count = 0
+        for v in levels[row * width : (row + 1) * width]:
+            bits = (bits << bpp) | v
+            count += bpp
+            if count == 8:
+                data.append(bits)
+                bits = 0
+                count = 0
+        if count:
+            data.append(bits << (8 - count))
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("font", help="TrueType font file")
+    parser.add_argument("--size", type=int, required=True, help="font size, in pixels")
+    parser.add_argument("--width", type=int, required=True, help="cell width, in pixels")
+    parser.add_argument("--height", type=int, required=True, help="cell height, in pixels")
+    parser.add_argument("--bpp", type=int, choices=(1, 4), default=1, help="bits per pixel")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20, help="first character")
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0x7E, help="last character")
+    parser.add_argument("--name", required=True, help="name of the struct ili9163c_font")
+    parser.add_argument("-o", "--output", required=True, help="output C file")
+    args = parser.parse_args()
+
+    font = ImageFont.truetype(args.font, args.size)
+    chars = [chr(c) for c in range(args.first, args.last + 1)]
+
+    # Centre the ink of all glyphs vertically, so that they share a baseline.
+    boxes = [font.getbbox(c) for c in chars if font.getbbox(c)[3] > font.getbbox(c)[1]]
+    top = min(b[1] for b in boxes)
+    bottom = max(b[3] for b in boxes)
+    if bottom - top > args.height:
+        print(f"error: glyphs are {bottom - top} pixels high", file=sys.stderr)
+        return 1
+    y_offset = (args.height - (bottom - top)) // 2 - top
+
+    with open(args.output, "w") as f:
+        f.write("/*\n")
+        f.write(" * Copyright (c) 2024, CATIE\n")
+        f.write(" * SPDX-License-Identifier: Apache-2.0\n")
+        f.write(" *\n")
+        f.write(
+            f" * Generated by scripts/ili9163c_font.py from {os.path.basename(args.font)},\n"
+            f" * size {args.size}, {args.width}x{args.height} pixels, {args.bpp} bpp.\n"
+        )
+        f.write(" */\n\n")
+        f.write("#include <zephyr/display/ili9163c_text.h>\n\n")
+        f.write(f"static const uint8_t {args.name}_glyphs[] = {{\n")
+        for char in chars:
+            levels = render(font, char, args.width, args.height, args.bpp, y_offset)
+            data = pack(levels, args.width, args.height, args.bpp)
+            label = f"'\\{char}'" if char in "\\'" else f"'{char}'"
+            f.write(f"\t/* 0x{ord(char):02x} {label} */\n")
+            for i in range(0, len(data), 8):
+                f.write("\t" + " ".join(f"0x{v:02x}," for v in data[i : i + 8]) + "\n")
+        f.write("};\n\n")
+        f.write(f"const struct ili9163c_font {args.name} = {{\n")
+        f.write(f"\t.glyphs = {args.name}_glyphs,\n")
+        f.write(f"\t.width = {args.width},\n")
+        f.write(f"\t.height = {args.height},\n")
+        f.write(f"\t.bpp = {args.bpp},\n")
+        f.write(f"\t.first = 0x{args.first:02x},\n")
+        f.write(f"\t.last = 0x{args.last:02x},\n")
+        f.write("};\n")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
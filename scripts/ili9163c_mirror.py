@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024, CATIE
+# SPDX-License-Identifier: Apache-2.0
+
+"""Decode an ILI9163C mirror stream to PPM or PNG images.
+
+The stream is produced by the ili9163c_mirror library, see
+include/zephyr/display/ili9163c_mirror.h for its format. It is read from a
+file, from standard input or from a serial port (requires pyserial).
+
+Examples:
+
+    # Last frame of a recorded stream
+    ili9163c_mirror.py mirror.bin -o screen.png
+
+    # Every frame, from the native_sim UART pseudo terminal
+    ili9163c_mirror.py --serial /dev/pts/3 -o frame_%05d.ppm
+"""
+
+import argparse
+import copy
+import struct
+import sys
+import zlib
+
+SYNC = 0xA5
+HEADER = ord("H")
+RECT = ord("R")
+FRAME = ord("F")
+VERSION = 1
+
+
+class StreamError(Exception):
+    pass
+
+
+class Reader:
+    def __init__(self, stream):
+        self.stream = stream
+
+    def read(self, size):
+        data = b""
+        while len(data) < size:
+            chunk = self.stream.read(size - len(data))
+            if not chunk:
+                raise EOFError
+            data += chunk
+        return data
+
+    def u8(self):
+        return self.read(1)[0]
+
+    def unpack(self, fmt):
+        return struct.unpack(fmt, self.read(struct.calcsize(fmt)))
+
+
+class Screen:
+    def __init__(self, width, height):
+        self.width = width
+        self.height = height
+        self.pixels = [0] * (width * height)
+
+    def read_rect(self, reader, x, y, w, h):
+        if x + w > self.width or y + h > self.height:
+            raise StreamError(f"rectangle {w}x{h}@{x},{y} outside the screen")
+
+        for row in range(y, y + h):
+            base = row * self.width + x
+            col = 0
+            while col < w:
+                n = reader.u8()
+                if n & 0x80:
+                    count = (n & 0x7F) + 1
+                    (pixel,) = reader.unpack("<H")
+                    pixels = [pixel] * count
+                else:
+                    count = n + 1
+                    pixels = list(reader.unpack(f"<{count}H"))
+                if col + count > w:
+                    raise StreamError("packet crosses the end of a row")
+                self.pixels[base + col : base + col + count] = pixels
+                col += count
+
+    def rgb888(self):
+        out = bytearray(self.width * self.height * 3)
+        for i, p in enumerate(self.pixels):
+            r = (p >> 11) & 0x1F
+            g = (p >> 5) & 0x3F
+            b = p & 0x1F
+            out[i * 3] = (r << 3) | (r >> 2)
+            out[i * 3 + 1] = (g << 2) | (g >> 4)
+            out[i * 3 + 2] = (b << 3) | (b >> 2)
+        return bytes(out)
+
+    def save(self, path):
+        data = self.rgb888()
+        with open(path, "wb") as f:
+            if path.lower().endswith(".png"):
+                f.write(png(self.width, self.height, data))
+            else:
+                f.write(b"P6\n%d %d\n255\n" % (self.width, self.height))
+                f.write(data)
+
+
+def png(width, height, rgb):
+    def chunk(kind, payload):
+        crc = zlib.crc32(kind + payload) & 0xFFFFFFFF
+        return struct.pack(">I", len(payload)) + kind + payload + struct.pack(">I", crc)
+
+    stride = width * 3
+    raw = b"".join(b"\x00" + rgb[y * stride : (y + 1) * stride] for y in range(height))
+
+    return (
+        b"\x89PNG\r\n\x1a\n"
+        + chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0))
+        + chunk(b"IDAT", zlib.compress(raw, 9))
+        + chunk(b"IEND", b"")
+    )
+
+
+def decode(reader, on_frame):
+    """Decode records until the end of the stream, calling on_frame(screen, seq, uptime)."""
+    screen = None
+    skipped = 0
+
+    while True:
+        try:
+            if reader.u8() != SYNC:
+                skipped += 1
+                continue
+
+            kind = reader.u8()
+            if kind == HEADER:
+                version, pixel_format, width, height = reader.unpack("<BBHH")
+                if version != VERSION or pixel_format != 0:
+                    raise StreamError(f"unsupported stream version {version}")
+                screen = Screen(width, height)
+            elif kind == RECT:
+                x, y, w, h = reader.unpack("<HHHH")
+                if screen is None:
+                    raise StreamError("rectangle before header")
+                screen.read_rect(reader, x, y, w, h)
+            elif kind == FRAME:
+                seq, uptime = reader.unpack("<II")
+                if screen is not None:
+                    on_frame(screen, seq, uptime)
+            else:
+                skipped += 2
+        except StreamError as e:
+            # Wait for the next header, which the device sends after sink errors.
+            print(f"warning: {e}, waiting for the next header", file=sys.stderr)
+            screen = None
+        except EOFError:
+            break
+
+    if skipped:
+        print(f"warning: skipped {skipped} bytes", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("input", nargs="?", help="stream file, standard input if omitted")
+    parser.add_argument("--serial", metavar="PORT", help="read the stream from a serial port")
+    parser.add_argument("--baudrate", type=int, default=115200, help="serial port baudrate")
+    parser.add_argument(
+        "-o",
+        "--output",
+        required=True,
+        help="output .png or .ppm file; with a %%d pattern, every frame is written",
+    )
+    args = parser.parse_args()
+
+    if args.serial:
+        import serial
+
+        stream = serial.Serial(args.serial, args.baudrate)
+    elif args.input:
+        stream = open(args.input, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    every = "%" in args.output
+    frames = 0
+    last = None
+
+    def on_frame(screen, seq, uptime):
+        nonlocal frames, last
+        frames += 1
+        if every:
+            screen.save(args.output % seq)
+        else:
+            # The decoder keeps updating the screen, keep the pixels of this frame.
+            last = copy.copy(screen)
+            last.pixels = list(screen.pixels)
+        print(f"frame {seq} at {uptime} ms", file=sys.stderr)
+
+    try:
+        decode(Reader(stream), on_frame)
+    except KeyboardInterrupt:
+        pass
+
+    if frames == 0:
+        print("error: no complete frame in the stream", file=sys.stderr)
+        return 1
+
+    if not every:
+        last.save(args.output)
+
+    print(f"{frames} frames decoded", file=sys.stderr)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,431 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024, CATIE
+# SPDX-License-Identifier: Apache-2.0
+
+"""Replay and analyze ILI9163C bus recordings.
+
+Recordings are produced by ili9163c_record_start(), see
+include/zephyr/drivers/display/ili9163c.h for their format. They are read
+from a binary file, or with --console from the output of a run using
+ili9163c_record_console_sink(). The transactions are replayed on a model of
+the controller to rebuild the panel image, and the bus traffic is reported:
+transactions, bytes, command overhead and modeled bus time.
+
+Examples:
+
+    # Report and rebuild the panel image from a native_sim run
+    west build -t run | ili9163c_record.py --console - -o panel.png
+
+    # Compare with a baseline recording, fail if the bus traffic grew by more than 2%
+    ili9163c_record.py --console new.log --compare baseline.log --max-regression 2
+"""
+
+import argparse
+import json
+import struct
+import sys
+import zlib
+
+HEADER = ord("H")
+COMMAND = ord("C")
+DATA = ord("D")
+READ = ord("R")
+RESET = ord("X")
+VERSION = 1
+
+CONSOLE_PREFIX = "ili9163c-record: "
+
+SWRESET = 0x01
+CASET = 0x2A
+PASET = 0x2B
+RAMWR = 0x2C
+MADCTL = 0x36
+PIXSET = 0x3A
+
+MADCTL_MY = 0x80
+MADCTL_MX = 0x40
+MADCTL_MV = 0x20
+
+PIXSET_MCU_12_BIT = 0x03
+PIXSET_MCU_16_BIT = 0x05
+PIXSET_MCU_18_BIT = 0x06
+
+COMMAND_NAMES = {
+    SWRESET: "SWRESET",
+    0x11: "SLPOUT",
+    0x20: "DINVOFF",
+    0x21: "DINVON",
+    0x26: "GAMSET",
+    0x28: "DISPOFF",
+    0x29: "DISPON",
+    CASET: "CASET",
+    PASET: "PASET",
+    RAMWR: "RAMWR",
+    0x2D: "RGBSET",
+    MADCTL: "MADCTL",
+    PIXSET: "PIXSET",
+}
+
+# Bus traffic metrics, lower is better.
+METRICS = ("transactions", "bus_bytes", "command_bytes", "bus_time_us")
+
+
+class RecordError(Exception):
+    pass
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def at_end(self):
+        return self.pos >= len(self.data)
+
+    def read(self, size):
+        if self.pos + size > len(self.data):
+            raise RecordError("truncated recording")
+        chunk = self.data[self.pos : self.pos + size]
+        self.pos += size
+        return chunk
+
+    def u8(self):
+        return self.read(1)[0]
+
+    def unpack(self, fmt):
+        return struct.unpack(fmt, self.read(struct.calcsize(fmt)))
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            byte = self.u8()
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+
+class Panel:
+    """Controller model, addressing GRAM as the ILI9163C emulator does."""
+
+    def __init__(self, width, height, madctl, pixset):
+        self.width = width
+        self.height = height
+        self.madctl = madctl
+        self.pixset = pixset
+        self.gram = bytearray(width * height * 3)
+        self.window = [0, width - 1, 0, height - 1]
+        self.col = 0
+        self.row = 0
+        self.pix = bytearray()
+        self.cmd = None
+        self.params = bytearray()
+        self.pixels = 0
+
+    def command(self, cmd, params):
+        self.cmd = cmd
+        self.params = bytearray()
+        self.pix = bytearray()
+
+        if cmd == SWRESET:
+            self.madctl = 0
+            self.pixset = 0x66
+            self.window = [0, self.width - 1, 0, self.height - 1]
+        elif cmd == RAMWR:
+            self.col = self.window[0]
+            self.row = self.window[2]
+
+        self.data(params)
+
+    def data(self, payload):
+        if self.cmd == RAMWR:
+            self.ramwr(payload)
+            return
+
+        self.params += payload
+        if self.cmd == CASET and len(self.params) >= 4:
+            self.window[0:2] = struct.unpack(">HH", self.params[:4])
+        elif self.cmd == PASET and len(self.params) >= 4:
+            self.window[2:4] = struct.unpack(">HH", self.params[:4])
+        elif self.cmd == MADCTL and self.params:
+            self.madctl = self.params[-1]
+        elif self.cmd == PIXSET and self.params:
+            self.pixset = self.params[-1]
+
+    def ramwr(self, payload):
+        mode = self.pixset & 0x07
+        if mode == PIXSET_MCU_12_BIT:
+            self.ramwr_12bit(payload)
+            return
+
+        size = 2 if mode == PIXSET_MCU_16_BIT else 3
+        stream = self.pix + payload
+        end = len(stream) - len(stream) % size
+
+        for i in range(0, end, size):
+            if size == 2:
+                (p,) = struct.unpack_from(">H", stream, i)
+                r = ((p >> 11) & 0x1F) << 3
+                g = ((p >> 5) & 0x3F) << 2
+                b = (p & 0x1F) << 3
+            else:
+                r = stream[i] & 0xFC
+                g = stream[i + 1] & 0xFC
+                b = stream[i + 2] & 0xFC
+            self.store(r, g, b)
+
+        self.pix = bytearray(stream[end:])
+
+    def ramwr_12bit(self, payload):
+        # 2 pixels in 3 bytes, each stored once its 12 bits are received.
+        stream = self.pix + payload
+        end = len(stream) - len(stream) % 3
+        first_stored = len(self.pix) == 2
+
+        for i in range(0, end, 3):
+            if not (i == 0 and first_stored):
+                self.store(stream[i] & 0xF0, (stream[i] << 4) & 0xF0, stream[i + 1] & 0xF0)
+            self.store(
+                (stream[i + 1] << 4) & 0xF0, stream[i + 2] & 0xF0, (stream[i + 2] << 4) & 0xF0
+            )
+
+        if len(stream) - end == 2 and not (end == 0 and first_stored):
+            self.store(stream[end] & 0xF0, (stream[end] << 4) & 0xF0, stream[end + 1] & 0xF0)
+
+        self.pix = bytearray(stream[end:])
+
+    def store(self, r, g, b):
+        x, y = self.col, self.row
+        if self.madctl & MADCTL_MV:
+            x, y = y, x
+        if self.madctl & MADCTL_MX:
+            x = self.width - 1 - x
+        if self.madctl & MADCTL_MY:
+            y = self.height - 1 - y
+
+        if 0 <= x < self.width and 0 <= y < self.height:
+            i = (y * self.width + x) * 3
+            self.gram[i : i + 3] = bytes((r, g, b))
+        self.pixels += 1
+
+        xs, xe, ys, ye = self.window
+        if self.col < xe:
+            self.col += 1
+        else:
+            self.col = xs
+            self.row = self.row + 1 if self.row < ye else ys
+
+    def save(self, path):
+        with open(path, "wb") as f:
+            if path.lower().endswith(".png"):
+                f.write(png(self.width, self.height, bytes(self.gram)))
+            else:
+                f.write(b"P6\n%d %d\n255\n" % (self.width, self.height))
+                f.write(self.gram)
+
+
+def png(width, height, rgb):
+    def chunk(kind, payload):
+        crc = zlib.crc32(kind + payload) & 0xFFFFFFFF
+        return struct.pack(">I", len(payload)) + kind + payload + struct.pack(">I", crc)
+
+    stride = width * 3
+    raw = b"".join(b"\x00" + rgb[y * stride : (y + 1) * stride] for y in range(height))
+
+    return (
+        b"\x89PNG\r\n\x1a\n"
+        + chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0))
+        + chunk(b"IDAT", zlib.compress(raw, 9))
+        + chunk(b"IEND", b"")
+    )
+
+
+def load(path, console):
+    """Read a recording from a binary file, or extract it from console output."""
+    if path == "-":
+        raw = sys.stdin.buffer.read()
+    else:
+        with open(path, "rb") as f:
+            raw = f.read()
+
+    if not console:
+        return raw
+
+    data = bytearray()
+    for line in raw.decode(errors="replace").splitlines():
+        pos = line.find(CONSOLE_PREFIX)
+        if pos >= 0:
+            data += bytes.fromhex(line[pos + len(CONSOLE_PREFIX) :].strip())
+    return bytes(data)
+
+
+def analyze(data, overhead_us=0.0, frequency=None):
+    """Replay a recording, return the panel model and the traffic report."""
+    reader = Reader(data)
+
+    if reader.at_end() or reader.u8() != HEADER:
+        raise RecordError("missing recording header")
+
+    version, width, height, madctl, pixset, bus_hz, cycles_hz = reader.unpack("<BHHBBII")
+    if version != VERSION:
+        raise RecordError(f"unsupported recording version {version}")
+
+    bus_hz = frequency or bus_hz
+    panel = Panel(width, height, madctl, pixset)
+    counts = {"commands": 0, "writes": 0, "reads": 0, "resets": 0}
+    opcodes = {}
+    command_bytes = 0
+    data_bytes = 0
+    cycles = 0
+
+    while not reader.at_end():
+        kind = reader.u8()
+        cycles += reader.varint()
+        arg = reader.u8()
+
+        if kind == COMMAND:
+            payload = reader.read(reader.varint())
+            panel.command(arg, payload)
+            counts["commands"] += 1
+            name = COMMAND_NAMES.get(arg, f"0x{arg:02X}")
+            opcodes[name] = opcodes.get(name, 0) + 1
+            command_bytes += 1 + len(payload)
+        elif kind == DATA:
+            payload = reader.read(reader.varint())
+            panel.data(payload)
+            counts["writes"] += 1
+            data_bytes += len(payload)
+        elif kind == READ:
+            reader.varint()
+            counts["reads"] += 1
+            command_bytes += 1
+        elif kind == RESET:
+            counts["resets"] += 1
+        else:
+            raise RecordError(f"unknown record type 0x{kind:02X} at offset {reader.pos - 1}")
+
+    transactions = counts["commands"] + counts["writes"] + counts["reads"]
+    bus_bytes = command_bytes + data_bytes
+    bus_time_us = (bus_bytes * 8e6 / bus_hz if bus_hz else 0.0) + transactions * overhead_us
+
+    report = {
+        "width": width,
+        "height": height,
+        "bus_hz": bus_hz,
+        **counts,
+        "transactions": transactions,
+        "opcodes": dict(sorted(opcodes.items())),
+        "command_bytes": command_bytes,
+        "data_bytes": data_bytes,
+        "bus_bytes": bus_bytes,
+        "command_overhead": command_bytes / bus_bytes if bus_bytes else 0.0,
+        "pixels": panel.pixels,
+        "bus_time_us": round(bus_time_us, 1),
+        "recorded_time_us": round(cycles * 1e6 / cycles_hz, 1) if cycles_hz else 0.0,
+        "recording_bytes": len(data),
+    }
+
+    return panel, report
+
+
+def print_report(name, report):
+    print(f"{name}: {report['width']}x{report['height']} panel at {report['bus_hz']} Hz")
+    print(
+        f"  transactions      {report['transactions']} "
+        f"({report['commands']} commands, {report['writes']} data writes, "
+        f"{report['reads']} reads, {report['resets']} resets)"
+    )
+    print("  commands          " + ", ".join(f"{k} {v}" for k, v in report["opcodes"].items()))
+    print(
+        f"  bus bytes         {report['bus_bytes']} "
+        f"({report['command_bytes']} command, {report['data_bytes']} data)"
+    )
+    print(f"  command overhead  {report['command_overhead']:.2%}")
+    print(f"  pixels            {report['pixels']}")
+    print(f"  modeled bus time  {report['bus_time_us']:.1f} us")
+    print(f"  recorded time     {report['recorded_time_us']:.1f} us")
+
+
+def compare(baseline, report, max_regression, out):
+    """Print the metric changes, return the metrics that regressed beyond the limit."""
+    regressions = []
+
+    print(f"{'metric':18}{'baseline':>14}{'current':>14}{'change':>10}", file=out)
+    for metric in METRICS:
+        old = baseline[metric]
+        new = report[metric]
+        change = (new - old) * 100.0 / old if old else 0.0
+        print(f"{metric:18}{old:>14}{new:>14}{change:>+9.1f}%", file=out)
+        if max_regression is not None and change > max_regression:
+            regressions.append(metric)
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("input", help="recording, - for standard input")
+    parser.add_argument(
+        "--console", action="store_true", help="extract the recording from console output"
+    )
+    parser.add_argument("-o", "--output", help="rebuilt panel image, .png or .ppm")
+    parser.add_argument("--json", action="store_true", help="print the report as JSON")
+    parser.add_argument(
+        "--frequency", type=int, help="bus frequency in Hz, instead of the recorded one"
+    )
+    parser.add_argument(
+        "--overhead-us",
+        type=float,
+        default=0.0,
+        help="fixed cost of each transaction in the modeled bus time, e.g. chip select",
+    )
+    parser.add_argument("--compare", metavar="BASELINE", help="baseline recording")
+    parser.add_argument(
+        "--max-regression",
+        type=float,
+        metavar="PCT",
+        help="with --compare, fail if a traffic metric grew by more than PCT percent",
+    )
+    args = parser.parse_args()
+
+    try:
+        panel, report = analyze(
+            load(args.input, args.console), args.overhead_us, args.frequency
+        )
+        if args.compare:
+            _, baseline = analyze(
+                load(args.compare, args.console), args.overhead_us, args.frequency
+            )
+    except (OSError, RecordError, ValueError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 2
+
+    if args.output:
+        panel.save(args.output)
+
+    if args.json:
+        result = {"current": report}
+        if args.compare:
+            result["baseline"] = baseline
+        print(json.dumps(result, indent=2))
+    else:
+        if args.compare:
+            print_report("baseline", baseline)
+        print_report("current" if args.compare else args.input, report)
+
+    if args.compare:
+        # Keep standard output parseable with --json.
+        out = sys.stderr if args.json else sys.stdout
+        regressions = compare(baseline, report, args.max_regression, out)
+        if regressions:
+            print(f"error: regression in {', '.join(regressions)}", file=sys.stderr)
+            return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
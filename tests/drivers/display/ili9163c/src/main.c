@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/display/ili9163c.h>
+#include <zephyr/drivers/display/ili9163c_emul.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define TEST_WIDTH  DT_PROP(DT_CHOSEN(zephyr_display), width)
+#define TEST_HEIGHT DT_PROP(DT_CHOSEN(zephyr_display), height)
+
+static const struct device *dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+static const struct emul *emul = EMUL_DT_GET(DT_NODELABEL(ili9163c_emul));
+
+static uint8_t buf[TEST_WIDTH * TEST_HEIGHT * 3U] __aligned(4);
+
+/* Color of each screen pixel, different from its neighbours on every channel. */
+static void test_color(uint16_t x, uint16_t y, uint8_t seed, uint8_t rgb[3])
+{
+	rgb[0] = (x + seed) * 17U;
+	rgb[1] = (y + seed) * 13U;
+	rgb[2] = (x ^ y ^ seed) * 29U;
+}
+
+/* Write an area in the current pixel format, with pitch - width pixels of padding per row. */
+static void test_write(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t pitch,
+		       uint8_t seed)
+{
+	struct display_capabilities capabilities;
+	struct display_buffer_descriptor desc = {
+		.width = width,
+		.height = height,
+		.pitch = pitch,
+	};
+	size_t bpp;
+	uint8_t rgb[3];
+	uint8_t *px;
+
+	display_get_capabilities(dev, &capabilities);
+	bpp = (capabilities.current_pixel_format == PIXEL_FORMAT_RGB_565) ? 2U : 3U;
+	desc.buf_size = pitch * height * bpp;
+
+	zassert_true(desc.buf_size <= sizeof(buf));
+
+	for (uint16_t row = 0U; row < height; row++) {
+		for (uint16_t col = 0U; col < pitch; col++) {
+			/* Padding gets the color of another pixel so that reading it is noticed. */
+			test_color(x + col, y + row, (col < width) ? seed : seed + 1U, rgb);
+			px = &buf[(row * pitch + col) * bpp];
+
+			if (bpp == 2U) {
+				sys_put_be16(((rgb[0] & 0xF8U) << 8) | ((rgb[1] & 0xFCU) << 3) |
+						     (rgb[2] >> 3),
+					     px);
+			} else {
+				px[0] = rgb[0];
+				px[1] = rgb[1];
+				px[2] = rgb[2];
+			}
+		}
+	}
+
+	zassert_ok(display_write(dev, x, y, &desc, buf));
+}
+
+/* Both input formats keep at least the 4 most significant bits of each channel. */
+static void test_check(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t seed)
+{
+	uint8_t expected[3];
+	uint8_t rgb[3];
+
+	for (uint16_t row = y; row < y + height; row++) {
+		for (uint16_t col = x; col < x + width; col++) {
+			test_color(col, row, seed, expected);
+			ili9163c_emul_get_pixel(emul, col, row, rgb);
+
+			zassert_equal(rgb[0], expected[0] & 0xF0U, "red of (%u, %u)", col, row);
+			zassert_equal(rgb[1], expected[1] & 0xF0U, "green of (%u, %u)", col, row);
+			zassert_equal(rgb[2], expected[2] & 0xF0U, "blue of (%u, %u)", col, row);
+		}
+	}
+}
+
+static void test_write_check(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+			     uint16_t pitch)
+{
+	static uint8_t seed;
+
+	/* A new color set for each write, so that stale GRAM content is noticed. */
+	seed++;
+
+	test_write(x, y, width, height, pitch, seed);
+	test_check(x, y, width, height, seed);
+}
+
+static void test_set_input(enum display_pixel_format pixel_format)
+{
+	int r = display_set_pixel_format(dev, pixel_format);
+
+	if (r == -ENOTSUP) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(r);
+}
+
+static void *ili9163c_rgb444_setup(void)
+{
+	zassert_true(device_is_ready(dev));
+	zassert_true(ili9163c_get_rgb444(dev), "pixel-format is not RGB444");
+
+	return NULL;
+}
+
+static void ili9163c_rgb444_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	display_set_pixel_format(dev, PIXEL_FORMAT_RGB_565);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb565_even_width)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write_check(0U, 0U, 128U, 4U, 128U);
+	test_write_check(8U, 10U, 16U, 16U, 16U);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb565_odd_width)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write_check(3U, 4U, 7U, 5U, 7U);
+	test_write_check(1U, 60U, 127U, 3U, 127U);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb565_odd_width_strided)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write_check(3U, 4U, 7U, 5U, 9U);
+	test_write_check(10U, 20U, 33U, 16U, 40U);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb565_single_pixel)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write_check(0U, 0U, 1U, 1U, 1U);
+	test_write_check(127U, 159U, 1U, 1U, 1U);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb565_full_frame)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write_check(0U, 0U, TEST_WIDTH, TEST_HEIGHT, TEST_WIDTH);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb888_even_width)
+{
+	test_set_input(PIXEL_FORMAT_RGB_888);
+	test_write_check(0U, 40U, 128U, 16U, 128U);
+	test_write_check(20U, 30U, 2U, 2U, 2U);
+}
+
+ZTEST(ili9163c_rgb444, test_rgb888_odd_width)
+{
+	test_set_input(PIXEL_FORMAT_RGB_888);
+	test_write_check(5U, 7U, 11U, 3U, 11U);
+	test_write_check(2U, 90U, 31U, 7U, 36U);
+	test_write_check(64U, 64U, 1U, 1U, 1U);
+}
+
+/* The odd pixel of a write must be sent at its end, not carried into the next write. */
+ZTEST(ili9163c_rgb444, test_odd_pixel_not_carried)
+{
+	test_set_input(PIXEL_FORMAT_RGB_565);
+	test_write(0U, 100U, 3U, 1U, 3U, 0x40U);
+	test_write(50U, 120U, 5U, 1U, 5U, 0x41U);
+	test_check(0U, 100U, 3U, 1U, 0x40U);
+	test_check(50U, 120U, 5U, 1U, 0x41U);
+}
+
+ZTEST_SUITE(ili9163c_rgb444, NULL, ili9163c_rgb444_setup, NULL, ili9163c_rgb444_after, NULL);